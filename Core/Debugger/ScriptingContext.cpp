@@ -12,6 +12,7 @@
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
 #include "Shared/SaveStateManager.h"
+#include "Shared/PerformanceCounters.h"
 #include "Utilities/magic_enum.hpp"
 #include "Shared/EventType.h"
 
@@ -303,6 +304,7 @@ void ScriptingContext::InternalCallMemoryCallback(AddressInfo relAddr, T& value,
 			needTimerReset = false;
 		}
 
+		PerfTimer perfTimer(_debugger->GetEmulator()->GetPerformanceCounters(), PerfCounter::Script);
 		int top = lua_gettop(_lua);
 		lua_rawgeti(_lua, LUA_REGISTRYINDEX, callback.Reference);
 		lua_pushinteger(_lua, relAddr.Address);
@@ -326,6 +328,7 @@ int ScriptingContext::CallEventCallback(EventType type, CpuType cpuType)
 		return 0;
 	}
 
+	PerfTimer perfTimer(_debugger->GetEmulator()->GetPerformanceCounters(), PerfCounter::Script);
 	_timer.Reset();
 	_context = this;
 	lua_setwatchdogtimer(_lua, ScriptingContext::ExecutionCountHook, 1000);
@@ -332,7 +332,7 @@ void GbaConsole::RunFrame()
 void GbaConsole::ProcessEndOfFrame()
 {
 	_controlManager->UpdateControlDevices();
-	_controlManager->UpdateInputState();
+	_controlManager->UpdateInputStateForNextFrame();
 }
 
 BaseControlManager* GbaConsole::GetControlManager()
@@ -99,6 +99,7 @@ uint8_t GbaControlManager::ReadInputPort(uint32_t addr)
 			return BitUtilities::GetBits<8>(_state.KeyControl);
 		}
 	} else {
+		LatchInput();
 		return (addr & 0x01) ? (_state.ActiveKeys >> 8) : (uint8_t)_state.ActiveKeys;
 	}
 }
@@ -129,8 +130,17 @@ void GbaControlManager::CheckForIrq()
 	}
 }
 
+bool GbaControlManager::CanDelayInputLatch()
+{
+	//The keypad IRQ needs the current input state to be checked at the end of the frame
+	return !(_state.KeyControl & 0x4000);
+}
+
 void GbaControlManager::WriteInputPort(GbaAccessModeVal mode, uint32_t addr, uint8_t value)
 {
+	//Enabling the keypad IRQ checks the input condition, make sure it uses the current input
+	LatchInput();
+
 	if(addr & 0x01) {
 		BitUtilities::SetBits<8>(_state.KeyControl, value);
 	} else {
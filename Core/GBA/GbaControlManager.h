@@ -19,6 +19,9 @@ private:
 	uint8_t ReadController(uint32_t addr);
 	void CheckForIrq();
 
+protected:
+	bool CanDelayInputLatch() override;
+
 public:
 	GbaControlManager(Emulator* emu, GbaConsole* console);
 	void Init(GbaMemoryManager* memoryManager);
@@ -5,6 +5,7 @@
 
 GbaArmOpCategory GbaCpu::_armCategory[0x1000];
 GbaCpu::Func GbaCpu::_armTable[0x1000];
+uint16_t GbaCpu::_conditionTable[0x10];
 
 GbaArmOpCategory GbaCpu::GetArmOpCategory(uint32_t opCode)
 {
@@ -504,7 +505,7 @@ void GbaCpu::ArmInvalidOp()
 #endif
 }
 
-bool GbaCpu::CheckConditions(uint32_t condCode)
+bool GbaCpu::EvalCondition(uint8_t condCode, bool n, bool z, bool c, bool v)
 {
 	/*Code Suffix Flags Meaning
 		0000 EQ Z set equal
@@ -524,20 +525,20 @@ bool GbaCpu::CheckConditions(uint32_t condCode)
 		1110 AL(ignored) always
 	*/
 	switch(condCode) {
-		case 0: return _state.CPSR.Zero;
-		case 1: return !_state.CPSR.Zero;
-		case 2: return _state.CPSR.Carry;
-		case 3: return !_state.CPSR.Carry;
-		case 4: return _state.CPSR.Negative;
-		case 5: return !_state.CPSR.Negative;
-		case 6: return _state.CPSR.Overflow;
-		case 7: return !_state.CPSR.Overflow;
-		case 8: return _state.CPSR.Carry && !_state.CPSR.Zero;
-		case 9: return !_state.CPSR.Carry || _state.CPSR.Zero;
-		case 10: return _state.CPSR.Negative == _state.CPSR.Overflow;
-		case 11: return _state.CPSR.Negative != _state.CPSR.Overflow;
-		case 12: return !_state.CPSR.Zero && (_state.CPSR.Negative == _state.CPSR.Overflow);
-		case 13: return _state.CPSR.Zero || (_state.CPSR.Negative != _state.CPSR.Overflow);
+		case 0: return z;
+		case 1: return !z;
+		case 2: return c;
+		case 3: return !c;
+		case 4: return n;
+		case 5: return !n;
+		case 6: return v;
+		case 7: return !v;
+		case 8: return c && !z;
+		case 9: return !c || z;
+		case 10: return n == v;
+		case 11: return n != v;
+		case 12: return !z && (n == v);
+		case 13: return z || (n != v);
 		case 14: return true;
 		case 15: return false;
 	}
@@ -545,6 +546,20 @@ bool GbaCpu::CheckConditions(uint32_t condCode)
 	return true;
 }
 
+void GbaCpu::InitConditionTable()
+{
+	//Precalculate the result of every condition code for every NZCV flag combination
+	for(int flags = 0; flags < 16; flags++) {
+		uint16_t result = 0;
+		for(int cond = 0; cond < 16; cond++) {
+			if(EvalCondition(cond, flags & 0x08, flags & 0x04, flags & 0x02, flags & 0x01)) {
+				result |= (1 << cond);
+			}
+		}
+		_conditionTable[flags] = result;
+	}
+}
+
 void GbaCpu::InitArmOpTable()
 {
 	auto addEntry = [=](int i, Func func, GbaArmOpCategory category) {
@@ -36,6 +36,7 @@ GbaCpu::~GbaCpu()
 
 void GbaCpu::StaticInit()
 {
+	InitConditionTable();
 	InitArmOpTable();
 	InitThumbOpTable();
 }
@@ -29,6 +29,7 @@ private:
 	static Func _thumbTable[0x100];
 	static GbaArmOpCategory _armCategory[0x1000];
 	static GbaThumbOpCategory _thumbCategory[0x100];
+	static uint16_t _conditionTable[0x10];
 
 	uint32_t Add(uint32_t op1, uint32_t op2, bool carry, bool updateFlags);
 	uint32_t Sub(uint32_t op1, uint32_t op2, bool carry, bool updateFlags);
@@ -69,7 +70,14 @@ private:
 	void ArmSoftwareInterrupt();
 	void ArmInvalidOp();
 
-	bool CheckConditions(uint32_t condCode);
+	static bool EvalCondition(uint8_t condCode, bool n, bool z, bool c, bool v);
+	static void InitConditionTable();
+
+	__forceinline bool CheckConditions(uint32_t condCode)
+	{
+		uint8_t flags = (_state.CPSR.Negative << 3) | (_state.CPSR.Zero << 2) | (_state.CPSR.Carry << 1) | (uint8_t)_state.CPSR.Overflow;
+		return _conditionTable[flags] & (1 << condCode);
+	}
 
 	static void InitThumbOpTable();
 	void ThumbMoveShiftedRegister();
@@ -48,6 +48,7 @@ GbaMemoryManager::GbaMemoryManager(Emulator* emu, GbaConsole* console, GbaPpu* p
 
 	_waitStatesLut = new uint8_t[0x400];
 	GenerateWaitStateLut();
+	InitFastMemoryBanks();
 
 	//Used to get the correct timing for the timer prescaler, based on the "timer" test
 	_masterClock = 48;
@@ -181,6 +182,80 @@ void GbaMemoryManager::GenerateWaitStateLut()
 	}
 }
 
+void GbaMemoryManager::InitFastMemoryBanks()
+{
+	//Only regions where InternalRead/InternalWrite have no side effects for 16/32-bit accesses are listed here
+	_fastReadBanks[0x02] = { _extWorkRam, GbaConsole::ExtWorkRamSize - 1, GbaConsole::ExtWorkRamSize };
+	_fastReadBanks[0x03] = { _intWorkRam, GbaConsole::IntWorkRamSize - 1, GbaConsole::IntWorkRamSize };
+	_fastReadBanks[0x05] = { _palette, GbaConsole::PaletteRamSize - 1, GbaConsole::PaletteRamSize };
+	//Only the first 64kb of VRAM (the upper 32kb has mirroring rules that depend on the PPU's mode)
+	_fastReadBanks[0x06] = { _vram, 0x1FFFF, 0x10000 };
+	_fastReadBanks[0x07] = { _oam, GbaConsole::SpriteRamSize - 1, GbaConsole::SpriteRamSize };
+
+	for(int i = 0; i < 0x10; i++) {
+		_fastWriteBanks[i] = _fastReadBanks[i];
+	}
+
+	//ROM reads (0x0D is excluded because it can be mapped to the EEPROM)
+	if(_prgRom) {
+		for(int i = 0x08; i <= 0x0C; i++) {
+			_fastReadBanks[i] = { _prgRom, 0x1FFFFFF, _prgRomSize };
+		}
+	}
+}
+
+template<typename T>
+bool GbaMemoryManager::TryFastRead(uint32_t addr, uint32_t& value)
+{
+	//addr must be aligned
+	uint8_t bank = addr >> 24;
+	if(bank >= 0x10) {
+		return false;
+	}
+
+	FastMemoryBank& b = _fastReadBanks[bank];
+	uint32_t offset = addr & b.Mask;
+	if(!b.Memory || offset + sizeof(T) > b.Size) {
+		return false;
+	}
+
+	T result;
+	memcpy(&result, b.Memory + offset, sizeof(T));
+	value = result;
+
+	if(bank >= 0x08) {
+		//Match the cart open bus state set by InternalRead (last 2 bytes read)
+		_state.CartOpenBus[0] = (uint8_t)(value >> (sizeof(T) * 8 - 16));
+		_state.CartOpenBus[1] = (uint8_t)(value >> (sizeof(T) * 8 - 8));
+	}
+	return true;
+}
+
+template<typename T>
+bool GbaMemoryManager::TryFastWrite(uint32_t addr, uint32_t value)
+{
+	//addr must be aligned
+	uint8_t bank = addr >> 24;
+	if(bank >= 0x10) {
+		return false;
+	}
+
+	FastMemoryBank& b = _fastWriteBanks[bank];
+	uint32_t offset = addr & b.Mask;
+	if(!b.Memory || offset + sizeof(T) > b.Size) {
+		return false;
+	}
+
+	T data = (T)value;
+	memcpy(b.Memory + offset, &data, sizeof(T));
+
+	//Match the internal open bus state set by InternalWrite
+	for(uint32_t i = 0; i < sizeof(T); i++) {
+		_state.InternalOpenBus[(addr + i) & 0x03] = (uint8_t)(value >> (i * 8));
+	}
+	return true;
+}
+
 uint8_t GbaMemoryManager::GetWaitStates(GbaAccessModeVal mode, uint32_t addr)
 {
 	return _waitStatesLut[((addr >> 22) & 0x3FC) | (mode & (GbaAccessMode::Word | ((addr & 0x1FFFF) ? GbaAccessMode::Sequential : 0)))];
@@ -275,9 +350,11 @@ uint32_t GbaMemoryManager::Read(GbaAccessModeVal mode, uint32_t addr)
 		value = isSigned ? (uint32_t)(int8_t)value : (uint8_t)value;
 		_emu->ProcessMemoryRead<CpuType::Gba, 1>(addr, value, mode & GbaAccessMode::Prefetch ? MemoryOperationType::ExecOpCode : MemoryOperationType::Read);
 	} else if(mode & GbaAccessMode::HalfWord) {
-		uint8_t b0 = InternalRead(mode, addr & ~0x01, addr);
-		uint8_t b1 = InternalRead(mode, addr | 1, addr);
-		value = b0 | (b1 << 8);
+		if(!TryFastRead<uint16_t>(addr & ~0x01, value)) {
+			uint8_t b0 = InternalRead(mode, addr & ~0x01, addr);
+			uint8_t b1 = InternalRead(mode, addr | 1, addr);
+			value = b0 | (b1 << 8);
+		}
 		UpdateOpenBus<2>(mode, addr, value);
 		value = isSigned ? (uint32_t)(int16_t)value : (uint16_t)value;
 		if(!(mode & GbaAccessMode::NoRotate)) {
@@ -285,11 +362,13 @@ uint32_t GbaMemoryManager::Read(GbaAccessModeVal mode, uint32_t addr)
 		}
 		_emu->ProcessMemoryRead<CpuType::Gba, 2>(addr & ~0x01, value, mode & GbaAccessMode::Prefetch ? MemoryOperationType::ExecOpCode : MemoryOperationType::Read);
 	} else {
-		uint8_t b0 = InternalRead(mode, addr & ~0x03, addr);
-		uint8_t b1 = InternalRead(mode, (addr & ~0x03) | 1, addr);
-		uint8_t b2 = InternalRead(mode, (addr & ~0x03) | 2, addr);
-		uint8_t b3 = InternalRead(mode, addr | 3, addr);
-		value = b0 | (b1 << 8) | (b2 << 16) | (b3 << 24);
+		if(!TryFastRead<uint32_t>(addr & ~0x03, value)) {
+			uint8_t b0 = InternalRead(mode, addr & ~0x03, addr);
+			uint8_t b1 = InternalRead(mode, (addr & ~0x03) | 1, addr);
+			uint8_t b2 = InternalRead(mode, (addr & ~0x03) | 2, addr);
+			uint8_t b3 = InternalRead(mode, addr | 3, addr);
+			value = b0 | (b1 << 8) | (b2 << 16) | (b3 << 24);
+		}
 		UpdateOpenBus<4>(mode, addr, value);
 		if(!(mode & GbaAccessMode::NoRotate)) {
 			value = RotateValue(mode, addr, value, isSigned);
@@ -329,12 +408,12 @@ void GbaMemoryManager::Write(GbaAccessModeVal mode, uint32_t addr, uint32_t valu
 			InternalWrite(mode, addr, (uint8_t)value, addr, value);
 		}
 	} else if(mode & GbaAccessMode::HalfWord) {
-		if(_emu->ProcessMemoryWrite<CpuType::Gba, 2>(addr & ~0x01, value, MemoryOperationType::Write)) {
+		if(_emu->ProcessMemoryWrite<CpuType::Gba, 2>(addr & ~0x01, value, MemoryOperationType::Write) && !TryFastWrite<uint16_t>(addr & ~0x01, value)) {
 			InternalWrite(mode, addr & ~0x01, (uint8_t)value, addr, value);
 			InternalWrite(mode, (addr & ~0x01) | 0x01, (uint8_t)(value >> 8), addr, value);
 		}
 	} else {
-		if(_emu->ProcessMemoryWrite<CpuType::Gba, 4>(addr & ~0x03, value, MemoryOperationType::Write)) {
+		if(_emu->ProcessMemoryWrite<CpuType::Gba, 4>(addr & ~0x03, value, MemoryOperationType::Write) && !TryFastWrite<uint32_t>(addr & ~0x03, value)) {
 			InternalWrite(mode, (addr & ~0x03), (uint8_t)value, addr, value);
 			InternalWrite(mode, (addr & ~0x03) | 0x01, (uint8_t)(value >> 8), addr, value);
 			InternalWrite(mode, (addr & ~0x03) | 0x02, (uint8_t)(value >> 16), addr, value);
@@ -21,6 +21,13 @@ class MgbaLogHandler;
 class GbaMemoryManager final : public ISerializable
 {
 private:
+	struct FastMemoryBank
+	{
+		uint8_t* Memory;
+		uint32_t Mask;
+		uint32_t Size;
+	};
+
 	Emulator* _emu = nullptr;
 	GbaConsole* _console = nullptr;
 	GbaPpu* _ppu = nullptr;
@@ -58,6 +65,10 @@ private:
 
 	uint8_t* _waitStatesLut = nullptr;
 
+	//Banks (by address bits 24-27) where aligned 16/32-bit accesses can be done directly on the memory
+	FastMemoryBank _fastReadBanks[0x10] = {};
+	FastMemoryBank _fastWriteBanks[0x10] = {};
+
 	__forceinline void ProcessWaitStates(GbaAccessModeVal mode, uint32_t addr);
 
 	__noinline void ProcessVramStalling(uint32_t addr);
@@ -68,6 +79,13 @@ private:
 	template<bool debug = false>
 	uint32_t RotateValue(GbaAccessModeVal mode, uint32_t addr, uint32_t value, bool isSigned);
 
+	void InitFastMemoryBanks();
+
+	template<typename T>
+	__forceinline bool TryFastRead(uint32_t addr, uint32_t& value);
+	template<typename T>
+	__forceinline bool TryFastWrite(uint32_t addr, uint32_t value);
+
 	__forceinline uint8_t InternalRead(GbaAccessModeVal mode, uint32_t addr, uint32_t readAddr);
 	__forceinline void InternalWrite(GbaAccessModeVal mode, uint32_t addr, uint8_t value, uint32_t writeAddr, uint32_t fullValue);
 
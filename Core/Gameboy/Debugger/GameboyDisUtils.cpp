@@ -166,7 +166,7 @@ EffectiveAddressInfo GameboyDisUtils::GetEffectiveAddress(DisassemblyInfo& info,
 	DummyGbCpu dummyCpu;
 	dummyCpu.Init(console->GetEmulator(), console, console->GetMemoryManager());
 	dummyCpu.SetDummyState(state);
-	dummyCpu.Exec();
+	dummyCpu.Exec<false>();
 
 	uint32_t count = dummyCpu.GetOperationCount();
 	for(int i = count - 1; i > 0; i--) {
@@ -121,7 +121,7 @@ void GbDebugger::ProcessInstruction()
 
 	if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _settings->GetDebugConfig().UsePredictiveBreakpoints) {
 		_dummyCpu->SetDummyState(state);
-		_dummyCpu->Exec();
+		_dummyCpu->Exec<false>();
 		for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
 			MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
 			if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
@@ -153,8 +153,14 @@ void Gameboy::PowerOn(SuperGameboy *sgb)
 
 void Gameboy::Run(uint64_t runUntilClock)
 {
-	while(_cpu->GetCycleCount() < runUntilClock) {
-		_cpu->Exec();
+	if(_emu->IsDebugging()) {
+		while(_cpu->GetCycleCount() < runUntilClock) {
+			_cpu->Exec<true>();
+		}
+	} else {
+		while(_cpu->GetCycleCount() < runUntilClock) {
+			_cpu->Exec<false>();
+		}
 	}
 }
 
@@ -515,8 +521,14 @@ GameboyModel Gameboy::GetEffectiveModel(GameboyHeader& header)
 void Gameboy::RunFrame()
 {
 	uint32_t frameCount = _ppu->GetFrameCount();
-	while(frameCount == _ppu->GetFrameCount()) {
-		_cpu->Exec();
+	if(_emu->IsDebugging()) {
+		while(frameCount == _ppu->GetFrameCount()) {
+			_cpu->Exec<true>();
+		}
+	} else {
+		while(frameCount == _ppu->GetFrameCount()) {
+			_cpu->Exec<false>();
+		}
 	}
 
 	_apu->Run();
@@ -526,7 +538,7 @@ void Gameboy::RunFrame()
 void Gameboy::ProcessEndOfFrame()
 {
 	_controlManager->UpdateControlDevices();
-	_controlManager->UpdateInputState();
+	_controlManager->UpdateInputStateForNextFrame();
 }
 
 BaseControlManager* Gameboy::GetControlManager()
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Gameboy/Gameboy.h"
 #include "Gameboy/GbMemoryManager.h"
+#include "Gameboy/GbCpu.h"
 #include "Gameboy/GbControlManager.h"
 #include "Gameboy/Input/GbController.h"
 #include "SNES/Coprocessors/SGB/SuperGameboy.h"
@@ -106,8 +107,17 @@ uint8_t GbControlManager::ReadInputPort()
 	return result | (inputSelect & 0x30) | 0xC0;
 }
 
+bool GbControlManager::CanDelayInputLatch()
+{
+	//The joypad IRQ and exiting STOP mode both depend on input changes, even if the game never reads P1
+	bool joypadIrqEnabled = _console->GetMemoryManager()->GetState().IrqEnabled & GbIrqSource::Joypad;
+	return !joypadIrqEnabled && !_console->GetCpu()->GetState().Stopped;
+}
+
 void GbControlManager::WriteInputPort(uint8_t value)
 {
+	LatchInput();
+
 	//Changing the select bits can trigger the joypad IRQ (Fixes Double Dragon 3 input issues)
 	ProcessInputChange([&]() { _state.InputSelect = value & 0x30; });
 
@@ -16,6 +16,9 @@ private:
 	GameboyConfig _prevConfig = {};
 	GbControlManagerState _state = {};
 
+protected:
+	bool CanDelayInputLatch() override;
+
 public:
 	GbControlManager(Emulator* emu, Gameboy* console);
 
@@ -48,6 +48,7 @@ bool GbCpu::HandleStoppedState()
 	return false;
 }
 
+template<bool debuggerEnabled>
 void GbCpu::Exec()
 {
 #ifndef DUMMYCPU
@@ -97,10 +98,12 @@ void GbCpu::Exec()
 
 	if(_state.HaltCounter) {
 		if(_state.HaltBug) {
-			ProcessHaltBug();
+			ProcessHaltBug<debuggerEnabled>();
 		} else {
 #ifndef DUMMYCPU
-			_emu->ProcessHaltedCpu<CpuType::Gameboy>();
+			if constexpr(debuggerEnabled) {
+				_emu->ProcessHaltedCpu<CpuType::Gameboy>();
+			}
 			if(_state.HaltCounter > 1) {
 				ProcessCgbSpeedSwitch();
 			}
@@ -113,7 +116,9 @@ void GbCpu::Exec()
 		}
 
 #ifndef DUMMYCPU
-		_emu->ProcessInstruction<CpuType::Gameboy>();
+		if constexpr(debuggerEnabled) {
+			_emu->ProcessInstruction<CpuType::Gameboy>();
+		}
 #endif
 		ExecOpCode(ReadOpCode());
 	}
@@ -157,6 +162,7 @@ void GbCpu::ProcessNextCycleStart()
 	}
 }
 
+template<bool debuggerEnabled>
 void GbCpu::ProcessHaltBug()
 {
 	if(_state.EiPending) {
@@ -165,7 +171,9 @@ void GbCpu::ProcessHaltBug()
 	}
 
 #ifndef DUMMYCPU
-	_emu->ProcessInstruction<CpuType::Gameboy>();
+	if constexpr(debuggerEnabled) {
+		_emu->ProcessInstruction<CpuType::Gameboy>();
+	}
 #endif
 
 	//HALT bug, execution continues, but PC isn't incremented for the first byte
@@ -866,6 +874,10 @@ void GbCpu::STOP()
 		_state.HaltCounter = 33942;
 #endif
 	} else {
+#ifndef DUMMYCPU
+		//Input changes wake the CPU up, so the input can no longer be latched late
+		((GbControlManager*)_gameboy->GetControlManager())->LatchInput();
+#endif
 		_state.Stopped = true;
 		_state.HaltCounter = 1;
 #ifndef DUMMYCPU
@@ -1538,3 +1550,6 @@ void GbCpu::Serialize(Serializer& s)
 	SV(_state.Stopped);
 	SV(_prevIrqVector);
 }
+
+template void GbCpu::Exec<true>();
+template void GbCpu::Exec<false>();
@@ -34,7 +34,7 @@ private:
 	void ExecOpCode(uint8_t opCode);
 
 	void ProcessCgbSpeedSwitch();
-	__noinline void ProcessHaltBug();
+	template<bool debuggerEnabled> __noinline void ProcessHaltBug();
 
 	__forceinline void ExecCpuCycle();
 	__forceinline void ExecMasterCycle();
@@ -171,7 +171,7 @@ public:
 
 	uint64_t GetCycleCount() { return _state.CycleCount; }
 
-	void Exec();
+	template<bool debuggerEnabled> void Exec();
 	void PowerOn();
 
 	void Serialize(Serializer& s) override;
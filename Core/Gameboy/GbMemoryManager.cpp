@@ -346,7 +346,10 @@ uint8_t GbMemoryManager::ReadRegister(uint16_t addr)
 				case 0xFF04: case 0xFF05: case 0xFF06: case 0xFF07:
 					return _timer->Read(addr);
 
-				case 0xFF0F: return _state.IrqRequests | 0xE0; //IF - Interrupt flags (R/W)
+				case 0xFF0F:
+					//A joypad IRQ may be pending on the delayed input
+					_controlManager->LatchInput();
+					return _state.IrqRequests | 0xE0; //IF - Interrupt flags (R/W)
 
 				default: return 0xFF; //Open bus
 			}
@@ -364,6 +367,7 @@ void GbMemoryManager::WriteRegister(uint16_t addr, uint8_t value)
 {
 	 if(addr >= 0xFF00) {
 		if(addr == 0xFFFF) {
+			_controlManager->LatchInput();
 			_state.IrqEnabled = value; //IE register
 		} else if(addr == 0xFF46) {
 			_dmaController->Write(value);
@@ -472,7 +472,7 @@ struct BgmTrackInfo
 struct HdPackData
 {
 private:
-	bool _cancelLoad = false;
+	atomic<bool> _cancelLoad = false;
 
 public:
 	static constexpr int BgLayerCount = 40;
@@ -506,17 +506,33 @@ public:
 
 	void LoadAsync()
 	{
+		vector<HdPackBitmapInfo*> bitmaps;
 		for(auto& bitmap : BackgroundFileData) {
-			bitmap->Init();
-			if(_cancelLoad) {
-				return;
-			}
+			bitmaps.push_back(bitmap.get());
 		}
 		for(auto& bitmap : ImageFileData) {
-			bitmap->Init();
-			if(_cancelLoad) {
-				return;
+			bitmaps.push_back(bitmap.get());
+		}
+
+		//Decode the PNG files on several threads - bitmaps needed by the emulation before
+		//they are decoded here are decoded on demand (Init() is thread-safe)
+		atomic<size_t> nextIndex = 0;
+		auto decodeBitmaps = [&]() {
+			size_t i;
+			while(!_cancelLoad && (i = nextIndex++) < bitmaps.size()) {
+				bitmaps[i]->Init();
 			}
+		};
+
+		uint32_t threadCount = std::clamp(std::thread::hardware_concurrency(), 1u, 8u);
+		vector<thread> workers;
+		for(uint32_t i = 1; i < threadCount && i < bitmaps.size(); i++) {
+			workers.emplace_back(decodeBitmaps);
+		}
+		decodeBitmaps();
+
+		for(thread& worker : workers) {
+			worker.join();
 		}
 	}
 
@@ -17,6 +17,7 @@ HdNesPack<scale>::HdNesPack(NesConsole* console, EmuSettings* settings, HdPackDa
 	_console = console;
 	_settings = settings;
 	_hdData = hdData;
+	_tileLookupCache.reset(new HdTileLookupEntry[TileLookupCacheSize]);
 
 	InitializeFallbackTiles();
 	CleanupInvalidRules();
@@ -439,7 +440,7 @@ HdPackTileInfo* HdNesPack<scale>::GetCachedMatchingTile(uint32_t x, uint32_t y,
 }
 
 template<uint32_t scale>
-HdPackTileInfo* HdNesPack<scale>::GetMatchingTile(uint32_t x, uint32_t y, HdPpuTileInfo* tile, bool* disableCache)
+vector<HdPackTileInfo*>* HdNesPack<scale>::FindTiles(HdPpuTileInfo* tile)
 {
 	auto hdTile = _hdData->TileByKey.find(*tile);
 	if(hdTile == _hdData->TileByKey.end()) {
@@ -461,8 +462,36 @@ HdPackTileInfo* HdNesPack<scale>::GetMatchingTile(uint32_t x, uint32_t y, HdPpuT
 		}
 	}
 
-	if(hdTile != _hdData->TileByKey.end()) {
-		for(HdPackTileInfo* hdPackTile : hdTile->second) {
+	return hdTile != _hdData->TileByKey.end() ? &hdTile->second : nullptr;
+}
+
+template<uint32_t scale>
+vector<HdPackTileInfo*>* HdNesPack<scale>::GetCachedTiles(HdPpuTileInfo* tile)
+{
+	//The tile list and fallback tiles never change after the pack is loaded, so lookup results can be kept indefinitely
+	uint32_t hash = tile->GetHashCode();
+	HdTileLookupEntry& entry = _tileLookupCache[(hash ^ (hash >> 12) ^ (hash >> 24)) & (TileLookupCacheSize - 1)];
+	//HdTileKey's == operator ignores the tile index for CHR RAM tiles, but fallback tiles depend on it
+	if(entry.Valid && entry.Key == *tile && entry.Key.TileIndex == tile->TileIndex) {
+		if(entry.FallbackTileIndex != HdTileKey::NoTile) {
+			tile->TileIndex = entry.FallbackTileIndex;
+		}
+		return entry.Tiles;
+	}
+
+	entry.Key = *tile;
+	entry.Tiles = FindTiles(tile);
+	entry.FallbackTileIndex = tile->TileIndex != entry.Key.TileIndex ? tile->TileIndex : HdTileKey::NoTile;
+	entry.Valid = true;
+	return entry.Tiles;
+}
+
+template<uint32_t scale>
+HdPackTileInfo* HdNesPack<scale>::GetMatchingTile(uint32_t x, uint32_t y, HdPpuTileInfo* tile, bool* disableCache)
+{
+	vector<HdPackTileInfo*>* tiles = GetCachedTiles(tile);
+	if(tiles) {
+		for(HdPackTileInfo* hdPackTile : *tiles) {
 			if(disableCache != nullptr && hdPackTile->ForceDisableCache) {
 				*disableCache = true;
 			}
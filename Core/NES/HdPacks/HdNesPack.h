@@ -46,6 +46,16 @@ private:
 		int16_t BgMaxX = -1;
 	};
 
+	struct HdTileLookupEntry
+	{
+		HdTileKey Key;
+		vector<HdPackTileInfo*>* Tiles = nullptr;
+		int32_t FallbackTileIndex = HdTileKey::NoTile; //Set when the tiles were found using a fallback tile
+		bool Valid = false;
+	};
+
+	static constexpr uint32_t TileLookupCacheSize = 0x1000;
+
 	static constexpr uint8_t PriorityLevelsPerLayer = 10;
 	static constexpr uint8_t BehindBgSpritesPriority = 0 * PriorityLevelsPerLayer;
 	static constexpr uint8_t BehindBgPriority = 1 * PriorityLevelsPerLayer;
@@ -67,6 +77,9 @@ private:
 	
 	unordered_map<HdTileKey, vector<HdPackAdditionalSpriteInfo>> _additionalTilesByKey;
 
+	//Direct-mapped cache of the results of the TileByKey lookups (including fallback/default tile lookups)
+	unique_ptr<HdTileLookupEntry[]> _tileLookupCache;
+
 	template<HdPackBlendMode blendMode>
 	__forceinline void BlendColors(uint8_t output[4], uint8_t input[4]);
 
@@ -75,6 +88,8 @@ private:
 	__forceinline void DrawTile(HdPpuTileInfo &tileInfo, HdPackTileInfo &hdPackTileInfo, uint32_t* outputBuffer, uint32_t screenWidth);
 	
 	__forceinline HdPackTileInfo* GetCachedMatchingTile(uint32_t x, uint32_t y, HdPpuTileInfo* tile);
+	vector<HdPackTileInfo*>* FindTiles(HdPpuTileInfo* tile);
+	__forceinline vector<HdPackTileInfo*>* GetCachedTiles(HdPpuTileInfo* tile);
 	__forceinline HdPackTileInfo* GetMatchingTile(uint32_t x, uint32_t y, HdPpuTileInfo* tile, bool* disableCache = nullptr);
 
 	__forceinline void DrawBackgroundLayer(uint8_t priority, uint32_t x, uint32_t y, uint32_t* outputBuffer, uint32_t screenWidth);
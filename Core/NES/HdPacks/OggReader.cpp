@@ -22,10 +22,16 @@ OggReader::~OggReader()
 bool OggReader::Init(string filename, bool loop, uint32_t sampleRate, uint32_t startOffset, uint32_t loopPosition)
 {
 	int error;
-	VirtualFile file = filename;
-	_fileData = vector<uint8_t>(100000);
-	if(file.ReadFile(_fileData)) {
-		_vorbis = stb_vorbis_open_memory(_fileData.data(), (int)_fileData.size(), &error, nullptr);
+	_file = filename;
+	uint32_t fileSize = (uint32_t)_file.GetSize();
+	const uint8_t* data = _file.GetSpan(0, fileSize);
+	if(!data && _file.ReadFile(_fileData)) {
+		data = _fileData.data();
+		fileSize = (uint32_t)_fileData.size();
+	}
+
+	if(data && fileSize > 0) {
+		_vorbis = stb_vorbis_open_memory(data, (int)fileSize, &error, nullptr);
 		if(_vorbis) {
 			_loop = loop;
 			if(loopPosition > 0) {
@@ -22,6 +22,8 @@ private:
 	int _sampleRate = 0;
 	int _oggSampleRate = 0;
 
+	//The file is memory-mapped when possible, _fileData is only used as a fallback
+	VirtualFile _file;
 	vector<uint8_t> _fileData;
 
 public:
@@ -257,11 +257,10 @@ void NesConsole::RunFrame()
 		_nextFrameOverclockDisabled = false;
 	}
 
-	while(frame == _ppu->GetFrameCount()) {
-		_cpu->Exec();
-		if(_vsSubConsole) {
-			RunVsSubConsole();
-		}
+	if(_emu->IsDebugging()) {
+		RunFrameLoop<true>(frame);
+	} else {
+		RunFrameLoop<false>(frame);
 	}
 
 	_apu->EndFrame();
@@ -272,6 +271,18 @@ void NesConsole::RunFrame()
 	}
 }
 
+template<bool debuggerEnabled>
+void NesConsole::RunFrameLoop(uint32_t frame)
+{
+	while(frame == _ppu->GetFrameCount()) {
+		_cpu->Exec<debuggerEnabled>();
+		if(_vsSubConsole) {
+			RunVsSubConsole<debuggerEnabled>();
+		}
+	}
+}
+
+template<bool debuggerEnabled>
 void NesConsole::RunVsSubConsole()
 {
 	int64_t cycleGap;
@@ -279,7 +290,7 @@ void NesConsole::RunVsSubConsole()
 		//Run the sub console until it catches up to the main CPU
 		cycleGap = (int64_t)(_cpu->GetCycleCount() - _vsSubConsole->_cpu->GetCycleCount());
 		if(cycleGap > 5 || _ppu->GetFrameCount() > _vsSubConsole->_ppu->GetFrameCount()) {
-			_vsSubConsole->_cpu->Exec();
+			_vsSubConsole->_cpu->Exec<debuggerEnabled>();
 		} else {
 			break;
 		}
@@ -57,6 +57,8 @@ private:
 	
 	void InitializeInputDevices(GameInputType inputType, GameSystem system);
 
+	template<bool debuggerEnabled> void RunFrameLoop(uint32_t frame);
+
 	void StartRecordingHdPack(HdPackBuilderOptions options);
 	void StopRecordingHdPack();
 
@@ -81,7 +83,7 @@ public:
 	NesConsole* GetVsMainConsole();
 	NesConsole* GetVsSubConsole();
 	bool IsVsMainConsole();
-	void RunVsSubConsole();
+	template<bool debuggerEnabled> void RunVsSubConsole();
 
 	void SetNextFrameOverclockStatus(bool disabled);
 
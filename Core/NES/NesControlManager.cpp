@@ -250,6 +250,9 @@ uint8_t NesControlManager::ReadRam(uint16_t addr)
 
 void NesControlManager::WriteRam(uint16_t addr, uint8_t value)
 {
+	//The controllers' state is latched when the strobe bit is cleared
+	LatchInput();
+
 	for(shared_ptr<BaseControlDevice> &device : _controlDevices) {
 		if(device->IsConnected()) {
 			device->WriteRam(addr, value);
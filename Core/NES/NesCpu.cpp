@@ -163,10 +163,13 @@ void NesCpu::Reset(bool softReset, ConsoleRegion region)
 	}
 }
 
+template<bool debuggerEnabled>
 void NesCpu::Exec()
 {
 #ifndef DUMMYCPU
-	_emu->ProcessInstruction<CpuType::Nes>();
+	if constexpr(debuggerEnabled) {
+		_emu->ProcessInstruction<CpuType::Nes>();
+	}
 #endif
 
 	uint8_t opCode = GetOPCode();
@@ -565,4 +568,7 @@ void NesCpu::Serialize(Serializer &s)
 		SV(_prevNmiFlag);
 		SV(_needNmi);
 	}
-}
\ No newline at end of file
+}
+
+template void NesCpu::Exec<true>();
+template void NesCpu::Exec<false>();
@@ -793,7 +793,7 @@ public:
 	bool IsDmcDma() { return _isDmcDmaRead; }
 
 	void Reset(bool softReset, ConsoleRegion region);
-	void Exec();
+	template<bool debuggerEnabled> void Exec();
 
 	NesCpuState& GetState()
 	{ 
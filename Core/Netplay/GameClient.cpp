@@ -42,6 +42,7 @@ void GameClient::Disconnect()
 {
 	_stop = true;
 	_connected = false;
+	_inputSignal.Signal();
 	if(_clientThread) {
 		_clientThread->join();
 		_clientThread.reset();
@@ -51,26 +52,51 @@ void GameClient::Disconnect()
 void GameClient::Exec()
 {
 	if(_connected) {
-		while(!_stop) {
-			if(!_connection->ConnectionError()) {
+		//Local input is sent from a separate thread, so this thread only needs to wake up when the server sends data
+		thread inputThread(&GameClient::SendInput, this);
+
+		vector<Socket*> sockets = { _connection->GetSocket() };
+		vector<bool> readyFlags;
+		while(!_stop && !_connection->ConnectionError()) {
+			//The timeout only exists to check the _stop flag
+			Socket::WaitForRead(sockets, readyFlags, GameClient::PollTimeout);
+			if(readyFlags[0]) {
+				std::lock_guard<std::mutex> lock(_connectionLock);
 				_connection->ProcessMessages();
-				_connection->SendInput();
-			} else {
-				break;
 			}
-			std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(1));
 		}
 		_connected = false;
+
+		_inputSignal.Signal();
+		inputThread.join();
+
 		_connection->Shutdown();
 	}
 }
 
+void GameClient::SendInput()
+{
+	while(!_stop && _connected) {
+		{
+			std::lock_guard<std::mutex> lock(_connectionLock);
+			_connection->SendInput();
+		}
+
+		//Woken up at the end of each frame (input is read once per frame), the timeout allows input to be sent while paused
+		_inputSignal.Wait(GameClient::PollTimeout);
+	}
+}
+
 void GameClient::ProcessNotification(ConsoleNotificationType type, void* parameter)
 {
 	if(!_connected) {
 		return;
 	}
 
+	if(type == ConsoleNotificationType::PpuFrameDone) {
+		_inputSignal.Signal();
+	}
+
 	if(type == ConsoleNotificationType::GameLoaded &&
 		std::this_thread::get_id() != _clientThread->get_id() && 
 		!_emu->IsEmulationThread()
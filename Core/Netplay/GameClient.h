@@ -1,6 +1,8 @@
 #pragma once
 #include "pch.h"
+#include <mutex>
 #include "Shared/Interfaces/INotificationListener.h"
+#include "Utilities/AutoResetEvent.h"
 #include "Netplay/NetplayTypes.h"
 
 class Socket;
@@ -11,14 +13,21 @@ class Emulator;
 class GameClient : public INotificationListener, public std::enable_shared_from_this<GameClient>
 {
 private:
+	static constexpr int PollTimeout = 50;
+
 	Emulator* _emu;
 	unique_ptr<thread> _clientThread;
 	unique_ptr<GameClientConnection> _connection;
 
+	//Serializes message processing and input sending, which run on separate threads
+	std::mutex _connectionLock;
+	AutoResetEvent _inputSignal;
+
 	atomic<bool> _stop;
 	atomic<bool> _connected;
 
 	void Exec();
+	void SendInput();
 
 public:
 	GameClient(Emulator* emu);
@@ -10,6 +10,8 @@
 #include "Netplay/ClientConnectionData.h"
 #include "Netplay/ForceDisconnectMessage.h"
 #include "Netplay/ServerInformationMessage.h"
+#include "Shared/Emulator.h"
+#include "Shared/PerformanceCounters.h"
 
 GameConnection::GameConnection(Emulator* emu, unique_ptr<Socket> socket)
 {
@@ -77,8 +79,24 @@ NetMessage* GameConnection::ReadMessage()
 
 void GameConnection::SendNetMessage(NetMessage &message)
 {
+	PerfTimer perfTimer(_emu->GetPerformanceCounters(), PerfCounter::Netplay);
 	auto lock = _socketLock.AcquireSafe();
 	message.Send(*_socket.get());
+	_socket->SendBuffer();
+}
+
+void GameConnection::QueueNetMessage(NetMessage &message)
+{
+	//Message is kept in the socket's buffer until FlushMessages is called
+	auto lock = _socketLock.AcquireSafe();
+	message.Send(*_socket.get());
+}
+
+void GameConnection::FlushMessages()
+{
+	PerfTimer perfTimer(_emu->GetPerformanceCounters(), PerfCounter::Netplay);
+	auto lock = _socketLock.AcquireSafe();
+	_socket->SendBuffer();
 }
 
 void GameConnection::Disconnect()
@@ -92,8 +110,14 @@ bool GameConnection::ConnectionError()
 	return _socket->ConnectionError();
 }
 
+Socket* GameConnection::GetSocket()
+{
+	return _socket.get();
+}
+
 void GameConnection::ProcessMessages()
 {
+	PerfTimer perfTimer(_emu->GetPerformanceCounters(), PerfCounter::Netplay);
 	NetMessage* message;
 	while((message = ReadMessage()) != nullptr) {
 		//Loop until all messages have been processed
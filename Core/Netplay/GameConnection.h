@@ -36,6 +36,9 @@ public:
 	virtual ~GameConnection();
 
 	bool ConnectionError();
+	Socket* GetSocket();
 	void ProcessMessages();
 	void SendNetMessage(NetMessage &message);
+	void QueueNetMessage(NetMessage &message);
+	void FlushMessages();
 };
\ No newline at end of file
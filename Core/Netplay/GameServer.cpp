@@ -40,13 +40,13 @@ void GameServer::AcceptConnections()
 	_listener->Listen(10);
 }
 
-void GameServer::UpdateConnections()
+void GameServer::UpdateConnections(vector<bool>& readyFlags)
 {
-	vector<unique_ptr<GameServerConnection>> connectionsToRemove;
+	//readyFlags[0] is the listener, readyFlags[i+1] matches _openConnections[i]
 	for(int i = (int)_openConnections.size() - 1; i >= 0; i--) {
 		if(_openConnections[i]->ConnectionError()) {
 			_openConnections.erase(_openConnections.begin() + i);
-		} else {
+		} else if(readyFlags[i + 1]) {
 			_openConnections[i]->ProcessMessages();
 		}
 	}
@@ -84,12 +84,13 @@ bool GameServer::SetInput(BaseControlDevice *device)
 
 void GameServer::RecordInput(vector<shared_ptr<BaseControlDevice>> devices)
 {
-	for(shared_ptr<BaseControlDevice> &device : devices) {
-		for(unique_ptr<GameServerConnection>& connection : _openConnections) {
-			if(!connection->ConnectionError()) {
-				//Send movie stream
+	for(unique_ptr<GameServerConnection>& connection : _openConnections) {
+		if(!connection->ConnectionError()) {
+			//Send movie stream - all of the frame's devices are batched into a single send
+			for(shared_ptr<BaseControlDevice> &device : devices) {
 				connection->SendMovieData(device->GetPort(), device->GetRawState());
 			}
+			connection->FlushMessages();
 		}
 	}
 }
@@ -115,11 +116,22 @@ void GameServer::Exec()
 	_initialized = true;
 	MessageManager::DisplayMessage("NetPlay" , "ServerStarted", std::to_string(_port));
 
+	vector<Socket*> sockets;
+	vector<bool> readyFlags;
 	while(!_stop) {
-		AcceptConnections();
-		UpdateConnections();
+		sockets.clear();
+		sockets.push_back(_listener.get());
+		for(unique_ptr<GameServerConnection>& connection : _openConnections) {
+			sockets.push_back(connection->GetSocket());
+		}
+
+		//Sleep until a client sends data or connects (the timeout only exists to check the _stop flag)
+		Socket::WaitForRead(sockets, readyFlags, GameServer::PollTimeout);
 
-		std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(1));
+		UpdateConnections(readyFlags);
+		if(readyFlags[0]) {
+			AcceptConnections();
+		}
 	}
 }
 
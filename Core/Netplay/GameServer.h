@@ -13,6 +13,8 @@ class Emulator;
 class GameServer : public IInputRecorder, public IInputProvider, public INotificationListener, public std::enable_shared_from_this<GameServer>
 {
 private:
+	static constexpr int PollTimeout = 50;
+
 	Emulator* _emu;
 	unique_ptr<thread> _serverThread;
 	unique_ptr<Socket> _listener;
@@ -27,7 +29,7 @@ private:
 	NetplayControllerInfo _hostControllerPort = {};
 
 	void AcceptConnections();
-	void UpdateConnections();
+	void UpdateConnections(vector<bool>& readyFlags);
 
 	void Exec();
 
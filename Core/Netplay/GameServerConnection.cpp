@@ -64,7 +64,7 @@ void GameServerConnection::SendMovieData(uint8_t port, ControlDeviceState state)
 {
 	if(_handshakeCompleted) {
 		MovieDataMessage message(state, port);
-		SendNetMessage(message);
+		QueueNetMessage(message);
 	}
 }
 
@@ -48,10 +48,13 @@ public:
 		stringstream out;
 		s.SaveTo(out);
 
+		//Only appends the message to the socket's send buffer, the caller is responsible for calling SendBuffer()
 		string data = out.str();
 		uint32_t messageLength = (uint32_t)data.size() + 1;
-		data = string((char*)&messageLength, 4) + (char)_type + data;
-		socket.Send((char*)data.c_str(), (int)data.size(), 0);
+		char type = (char)_type;
+		socket.BufferedSend((char*)&messageLength, 4);
+		socket.BufferedSend(&type, 1);
+		socket.BufferedSend((char*)data.c_str(), (int)data.size());
 	}
 
 protected:
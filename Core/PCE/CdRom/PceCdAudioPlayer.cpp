@@ -33,6 +33,9 @@ void PceCdAudioPlayer::Play(uint32_t startSector, bool pause)
 		_state.CurrentSector = startSector;
 
 		_clockCounter = 0;
+
+		//Start loading the track in the background while the seek delay elapses
+		_cdrom->GetSectorCache().Prefetch(startSector);
 	}
 }
 
@@ -50,8 +53,14 @@ void PceCdAudioPlayer::SetEndPosition(uint32_t endSector, CdPlayEndBehavior endB
 void PceCdAudioPlayer::PlaySample()
 {
 	if(_state.Status == CdAudioStatus::Playing) {
-		_state.LeftSample = _disc->ReadLeftSample(_state.CurrentSector, _state.CurrentSample);
-		_state.RightSample = _disc->ReadRightSample(_state.CurrentSector, _state.CurrentSample);
+		if(_loadedSector != (int64_t)_state.CurrentSector) {
+			_cdrom->GetSectorCache().ReadSector(_state.CurrentSector, _sectorData);
+			_loadedSector = _state.CurrentSector;
+		}
+
+		uint8_t* sample = _sectorData + _state.CurrentSample * 4;
+		_state.LeftSample = (int16_t)(sample[0] | (sample[1] << 8));
+		_state.RightSample = (int16_t)(sample[2] | (sample[3] << 8));
 		_samplesToPlay.push_back(_state.LeftSample);
 		_samplesToPlay.push_back(_state.RightSample);
 		_state.CurrentSample++;
@@ -17,6 +17,10 @@ class PceCdAudioPlayer final : public IAudioProvider, public ISerializable
 
 	PceCdAudioPlayerState _state = {};
 
+	//Copy of the sector currently being played
+	uint8_t _sectorData[2352] = {};
+	int64_t _loadedSector = -1;
+
 	vector<int16_t> _samplesToPlay;
 	uint32_t _clockCounter = 0;
 	uint32_t _seekDelay = 0;
@@ -7,6 +7,7 @@
 #include "PCE/PceTypes.h"
 #include "Shared/MemoryType.h"
 #include "Shared/CdReader.h"
+#include "Shared/CdSectorCache.h"
 #include "Utilities/ISerializable.h"
 
 class Emulator;
@@ -20,6 +21,7 @@ private:
 	PceConsole* _console = nullptr;
 
 	DiscInfo _disc;
+	CdSectorCache _sectorCache;
 	PceScsiBus _scsi;
 	PceAdpcm _adpcm;
 	PceAudioFader _audioFader;
@@ -60,6 +62,7 @@ public:
 
 	PceCdAudioPlayer& GetAudioPlayer() { return _audioPlayer; }
 	PceAudioFader& GetAudioFader() { return _audioFader; }
+	CdSectorCache& GetSectorCache() { return _sectorCache; }
 	
 	uint32_t GetCurrentSector();
 
@@ -230,6 +230,9 @@ void PceScsiBus::CmdRead()
 	_state.Sector = sector;
 	_state.SectorsToRead = sectorsToRead;
 
+	//Start loading the sectors in the background while the seek delay elapses
+	_cdrom->GetSectorCache().Prefetch(sector);
+
 	//Set the phase to "data in" right away
 	//Ys IV appears to expect this to happen relatively quickly after
 	//sending the read command to the drive. Otherwise it keeps waiting in a loop
@@ -451,7 +454,7 @@ void PceScsiBus::ProcessDiscRead()
 			if(_dataBuffer.empty()) {
 				//read disc data
 				_dataBuffer.clear();
-				_disc->ReadDataSector(_state.Sector, _dataBuffer);
+				_cdrom->GetSectorCache().ReadDataSector(_state.Sector, _dataBuffer);
 
 				LogDebug("[SCSI] Sector #" + std::to_string(_state.Sector) + " finished reading.");
 
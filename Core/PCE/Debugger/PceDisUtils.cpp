@@ -213,7 +213,7 @@ EffectiveAddressInfo PceDisUtils::GetEffectiveAddress(DisassemblyInfo& info, Pce
 
 	DummyPceCpu pceCpu(nullptr, console->GetMemoryManager());
 	pceCpu.SetDummyState(state);
-	pceCpu.Exec();
+	pceCpu.Exec<false>();
 
 	uint32_t count = pceCpu.GetOperationCount();
 	for(int i = count - 1; i > 0; i--) {
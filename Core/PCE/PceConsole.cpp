@@ -155,8 +155,14 @@ bool PceConsole::IsSuperGrafxCard(uint32_t crc32)
 void PceConsole::RunFrame()
 {
 	uint32_t frameCount = _vdc->GetFrameCount();
-	while(frameCount == _vdc->GetFrameCount()) {
-		_cpu->Exec();
+	if(_emu->IsDebugging()) {
+		while(frameCount == _vdc->GetFrameCount()) {
+			_cpu->Exec<true>();
+		}
+	} else {
+		while(frameCount == _vdc->GetFrameCount()) {
+			_cpu->Exec<false>();
+		}
 	}
 	
 	_psg->Run();
@@ -63,6 +63,8 @@ uint8_t PceControlManager::ReadInputPort()
 
 void PceControlManager::WriteInputPort(uint8_t value)
 {
+	LatchInput();
+
 	for(shared_ptr<BaseControlDevice>& device : _controlDevices) {
 		if(device->IsConnected()) {
 			device->WriteRam(0, value);
@@ -91,10 +91,13 @@ PceCpu::PceCpu(Emulator* emu, PceMemoryManager* memoryManager)
 }
 #endif
 
+template<bool debuggerEnabled>
 void PceCpu::Exec()
 {
 #ifndef DUMMYCPU
-	_emu->ProcessInstruction<CpuType::Pce>();
+	if constexpr(debuggerEnabled) {
+		_emu->ProcessInstruction<CpuType::Pce>();
+	}
 #endif
 
 	//T flag is reset at the start of each instruction
@@ -463,3 +466,6 @@ void PceCpu::Serialize(Serializer& s)
 	SV(_state.Y);
 	SV(_state.CycleCount);
 }
+
+template void PceCpu::Exec<true>();
+template void PceCpu::Exec<false>();
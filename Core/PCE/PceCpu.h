@@ -299,7 +299,7 @@ public:
 	
 	void RunIdleCpuCycle();
 
-	void Exec();
+	template<bool debuggerEnabled> void Exec();
 
 	void Serialize(Serializer& s) override;
 
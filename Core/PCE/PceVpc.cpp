@@ -303,7 +303,7 @@ void PceVpc::SendFrame(PceVdc* vdc)
 	_console->ProcessEndOfFrame();
 	_emu->ProcessEndOfFrame();
 
-	_console->GetControlManager()->UpdateInputState();
+	_console->GetControlManager()->UpdateInputStateForNextFrame();
 	_console->GetControlManager()->UpdateControlDevices();
 }
 
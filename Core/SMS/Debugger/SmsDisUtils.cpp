@@ -296,7 +296,7 @@ EffectiveAddressInfo SmsDisUtils::GetEffectiveAddress(DisassemblyInfo& info, Sms
 	DummySmsCpu dummyCpu;
 	dummyCpu.Init(console->GetEmulator(), console, console->GetMemoryManager());
 	dummyCpu.SetDummyState(state);
-	dummyCpu.Exec();
+	dummyCpu.Exec<false>();
 
 	uint32_t count = dummyCpu.GetOperationCount();
 	for(int i = count - 1; i > 0; i--) {
@@ -129,8 +129,14 @@ void SmsConsole::RunFrame()
 	UpdateRegion(false);
 
 	uint32_t frame = _vdp->GetFrameCount();
-	while(frame == _vdp->GetFrameCount()) {
-		_cpu->Exec();
+	if(_emu->IsDebugging()) {
+		while(frame == _vdp->GetFrameCount()) {
+			_cpu->Exec<true>();
+		}
+	} else {
+		while(frame == _vdp->GetFrameCount()) {
+			_cpu->Exec<false>();
+		}
 	}
 
 	_psg->Run();
@@ -140,7 +146,7 @@ void SmsConsole::RunFrame()
 void SmsConsole::ProcessEndOfFrame()
 {
 	_controlManager->UpdateControlDevices();
-	_controlManager->UpdateInputState();
+	_controlManager->UpdateInputStateForNextFrame();
 }
 
 void SmsConsole::UpdateRegion(bool forceUpdate)
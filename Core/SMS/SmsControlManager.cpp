@@ -80,6 +80,8 @@ uint8_t SmsControlManager::InternalReadPort(uint8_t port)
 
 uint8_t SmsControlManager::ReadPort(uint8_t port)
 {
+	LatchInput();
+
 	uint8_t value = InternalReadPort(port);
 
 	//Set TR/TH based on the $3F config
@@ -30,16 +30,21 @@ SmsCpuState& SmsCpu::GetState()
 	return _state;
 }
 
+template<bool debuggerEnabled>
 void SmsCpu::Exec()
 {
 	uint8_t opCode = 0;
 	_state.FlagsChanged <<= 1;
 	if(_state.Halted) {
-		_emu->ProcessHaltedCpu<CpuType::Sms>();
+		if constexpr(debuggerEnabled) {
+			_emu->ProcessHaltedCpu<CpuType::Sms>();
+		}
 		ExecCycles(4);
 	} else {
 		#ifndef DUMMYCPU
-		_emu->ProcessInstruction<CpuType::Sms>();
+		if constexpr(debuggerEnabled) {
+			_emu->ProcessInstruction<CpuType::Sms>();
+		}
 		#endif
 		opCode = ReadOpCode();
 		ExecOpCode<0>(opCode);
@@ -2091,4 +2096,7 @@ void SmsCpu::Serialize(Serializer& s)
 	SV(_state.IM);
 	SV(_state.FlagsChanged);
 	SV(_state.WZ);
-}
\ No newline at end of file
+}
+
+template void SmsCpu::Exec<true>();
+template void SmsCpu::Exec<false>();
@@ -258,7 +258,7 @@ public:
 	void ClearIrqSource(SmsIrqSource source) { _state.ActiveIrqs &= ~(int)source; }
 	void SetNmiLevel(bool nmiLevel);
 
-	void Exec();
+	template<bool debuggerEnabled> void Exec();
 
 	void Serialize(Serializer& s) override;
 
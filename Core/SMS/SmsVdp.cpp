@@ -433,8 +433,9 @@ void SmsVdp::ProcessScanlineEvents()
 				_currentOutputBuffer = _currentOutputBuffer == _outputBuffers[0] ? _outputBuffers[1] : _outputBuffers[0];
 				_activeSgPalette = _emu->GetSettings()->GetSmsConfig().UseSgPalette ? _originalSgPalette : _smsSgPalette;
 
-				_console->ProcessEndOfFrame();
+				//Wait for the next frame before polling the input, to keep the input latency as low as possible
 				_emu->ProcessEndOfFrame();
+				_console->ProcessEndOfFrame();
 			} else if(_state.Scanline >= _scanlineCount) {
 				_state.Scanline = 0;
 				_state.VerticalScrollLatch = _state.VerticalScroll;
@@ -65,15 +65,28 @@ void Cx4::Run()
 {
 	uint64_t targetCycle = (uint64_t)(_memoryManager->GetMasterClock() * _clockRatio);
 
+	if(_emu->IsDebugging()) {
+		Run<true>(targetCycle);
+	} else {
+		Run<false>(targetCycle);
+	}
+}
+
+template<bool debuggerEnabled>
+void Cx4::Run(uint64_t targetCycle)
+{
 	while(_state.CycleCount < targetCycle) {
 		if(_state.Locked) {
-			Step(1);
+			//Only the CPU can unlock the CX4, skip ahead to the target cycle
+			Step(targetCycle - _state.CycleCount);
 		} else if(_state.Suspend.Enabled) {
 			if(_state.Suspend.Duration == 0) {
-				Step(1);
+				//Suspended until the CPU resumes execution
+				Step(targetCycle - _state.CycleCount);
 			} else {
-				Step(1);
-				_state.Suspend.Duration--;
+				uint32_t cycles = (uint32_t)std::min<uint64_t>(_state.Suspend.Duration, targetCycle - _state.CycleCount);
+				Step(cycles);
+				_state.Suspend.Duration -= cycles;
 				if(_state.Suspend.Duration == 0) {
 					_state.Suspend.Enabled = false;
 				}
@@ -90,7 +103,9 @@ void Cx4::Run()
 				Stop();
 			}
 		} else {
-			_emu->ProcessInstruction<CpuType::Cx4>();
+			if constexpr(debuggerEnabled) {
+				_emu->ProcessInstruction<CpuType::Cx4>();
+			}
 
 			uint16_t opCode = _prgRam[_state.Cache.Page][_state.PC];
 			_state.PC++;
@@ -26,6 +26,7 @@ private:
 	uint8_t _dataRam[Cx4::DataRamSize];
 
 	void Exec(uint16_t opCode);
+	template<bool debuggerEnabled> void Run(uint64_t targetCycle);
 	void SwitchCachePage();
 	bool ProcessCache(uint64_t targetCycle);
 	void ProcessDma(uint64_t targetCycle);
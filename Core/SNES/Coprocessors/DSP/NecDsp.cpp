@@ -143,10 +143,13 @@ void NecDsp::BuildProgramCache()
 	}
 }
 
+template<bool debuggerEnabled>
 void NecDsp::ReadOpCode()
 {
 	_opCode = _prgCache[_state.PC & _progMask];
-	_emu->ProcessMemoryRead<CpuType::NecDsp>(_state.PC & _progMask, _opCode, MemoryOperationType::ExecOpCode);
+	if constexpr(debuggerEnabled) {
+		_emu->ProcessMemoryRead<CpuType::NecDsp>(_state.PC & _progMask, _opCode, MemoryOperationType::ExecOpCode);
+	}
 }
 
 void NecDsp::Run()
@@ -158,9 +161,21 @@ void NecDsp::Run()
 		return;
 	}
 
+	if(_emu->IsDebugging()) {
+		Exec<true>(targetCycle);
+	} else {
+		Exec<false>(targetCycle);
+	}
+}
+
+template<bool debuggerEnabled>
+void NecDsp::Exec(uint64_t targetCycle)
+{
 	while(_state.CycleCount < targetCycle) {
-		_emu->ProcessInstruction<CpuType::NecDsp>();
-		ReadOpCode();
+		if constexpr(debuggerEnabled) {
+			_emu->ProcessInstruction<CpuType::NecDsp>();
+		}
+		ReadOpCode<debuggerEnabled>();
 		_state.PC++;
 
 		switch(_opCode & 0xC00000) {
@@ -170,10 +185,10 @@ void NecDsp::Run()
 			case 0xC00000: Load(_opCode & 0x0F, (uint16_t)(_opCode >> 6)); break;
 		}
 
-		//Store the multiplication's result
-		int32_t multResult = (int16_t)_state.K * (int16_t)_state.L;
-		_state.M = multResult >> 15;
-		_state.N = multResult << 1;
+		if constexpr(debuggerEnabled) {
+			//K/L can be modified by the debugger, so always update the multiplication's result
+			UpdateMultResult();
+		}
 
 		_state.CycleCount++;
 	}
@@ -435,6 +450,7 @@ void NecDsp::Jump()
 	uint8_t bank = _opCode & 0x03;
 	uint16_t address = (_opCode >> 2) & 0x7FF;
 	uint16_t target = (_state.PC & 0x2000) | (bank << 11) | address;
+	uint16_t nextPc = _state.PC;
 	uint32_t jmpCond = 0;
 
 	uint16_t jmpType = (_opCode >> 13) & 0x1FF;
@@ -498,12 +514,14 @@ void NecDsp::Jump()
 	}
 
 	if(jmpCond) {
-		if((_state.PC - 1 == target) && (jmpType == 0xBC || jmpType == 0xBE)) {
-			//CPU is in a wait loop for RQM, skip emulation until the CPU reads/writes from the IO registers
-			_inRqmLoop = true;
-		}
 		_state.PC = target;
 	}
+
+	if(_state.PC == (uint16_t)(nextPc - 1) && jmpType < 0x140) {
+		//The jump loops on itself (e.g waiting for RQM) - jumps can't change the conditions they check,
+		//so nothing can happen until the CPU reads/writes the data register, skip emulation until then
+		_inRqmLoop = true;
+	}
 }
 
 void NecDsp::Load(uint8_t dest, uint16_t value)
@@ -527,19 +545,21 @@ void NecDsp::Load(uint8_t dest, uint16_t value)
 
 		case 0x08: _state.SerialOut = value; break;
 		case 0x09: _state.SerialOut = value; break;
-		case 0x0A: _state.K = value; break;
+		case 0x0A: _state.K = value; UpdateMultResult(); break;
 
 		case 0x0B:
 			_state.K = value;
 			_state.L = ReadRom(_state.RP);
+			UpdateMultResult();
 			break;
 
 		case 0x0C:
 			_state.L = value;
 			_state.K = ReadRam(_state.DP | 0x40);
+			UpdateMultResult();
 			break;
 
-		case 0x0D: _state.L = value; break;
+		case 0x0D: _state.L = value; UpdateMultResult(); break;
 		case 0x0E: _state.TRB = value; break;
 		case 0x0F: WriteRam(_state.DP, value); break;
 
@@ -41,9 +41,17 @@ private:
 	uint32_t _stackMask = 0;
 
 	uint16_t _registerMask = 0;
-	bool _inRqmLoop = false;
+	bool _inRqmLoop = false; //Set when the DSP is in any loop that can only end when the CPU accesses the data register
 
-	void ReadOpCode();
+	__forceinline void UpdateMultResult()
+	{
+		int32_t multResult = (int16_t)_state.K * (int16_t)_state.L;
+		_state.M = multResult >> 15;
+		_state.N = multResult << 1;
+	}
+
+	template<bool debuggerEnabled> void ReadOpCode();
+	template<bool debuggerEnabled> void Exec(uint64_t targetCycle);
 
 	void RunApuOp(uint8_t aluOperation, uint16_t source);
 
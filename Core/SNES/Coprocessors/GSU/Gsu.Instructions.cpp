@@ -698,11 +698,12 @@ void Gsu::WritePixelCache(GsuPixelCache &cache)
 
 	uint32_t tileAddress = GetTileAddress(cache.X, cache.Y);
 
+	uint64_t pixels;
+	memcpy(&pixels, cache.Pixels, sizeof(pixels));
+
 	for(int i = 0; i < _state.PlotBpp; i++) {
-		uint8_t value = 0;
-		for(int x = 0; x < 8; x++) {
-			value |= ((cache.Pixels[x] >> i) & 0x01) << x;
-		}
+		//Gather bit i of all 8 pixels into a single byte (pixel n's bit goes to bit n)
+		uint8_t value = (uint8_t)((((pixels >> i) & 0x0101010101010101ULL) * 0x0102040810204080ULL) >> 56);
 
 		//Select which byte to read/write based on the current bit (0/1, 16/17, 32/33, 48/49)
 		uint8_t byte = ((i >> 1) << 4) + (i & 0x01);
@@ -90,8 +90,14 @@ void Gsu::Run()
 {
 	uint64_t targetCycle = _memoryManager->GetMasterClock() * _clockMultiplier;
 
-	while(!_stopped && _state.CycleCount < targetCycle) {
-		Exec();
+	if(_emu->IsDebugging()) {
+		while(!_stopped && _state.CycleCount < targetCycle) {
+			Exec<true>();
+		}
+	} else {
+		while(!_stopped && _state.CycleCount < targetCycle) {
+			Exec<false>();
+		}
 	}
 
 	if(targetCycle > _state.CycleCount) {
@@ -99,6 +105,7 @@ void Gsu::Run()
 	}
 }
 
+template<bool debuggerEnabled>
 void Gsu::Exec()
 {
 	uint8_t opCode = ReadOpCode();
@@ -229,8 +236,10 @@ void Gsu::Exec()
 			break;
 	}
 
-	if(_state.SFR.Running) {
-		_emu->ProcessInstruction<CpuType::Gsu>();
+	if constexpr(debuggerEnabled) {
+		if(_state.SFR.Running) {
+			_emu->ProcessInstruction<CpuType::Gsu>();
+		}
 	}
 
 	if(!_r15Changed) {
@@ -425,10 +434,8 @@ void Gsu::WriteRam(uint16_t addr, uint8_t value)
 	_state.RamWriteValue = value;
 }
 
-void Gsu::Step(uint64_t cycles)
+void Gsu::ProcessPendingAccess(uint64_t cycles)
 {
-	_state.CycleCount += cycles;
-
 	if(_state.RomDelay) {
 		_state.RomDelay -= std::min<uint8_t>((uint8_t)cycles, _state.RomDelay);
 		if(_state.RomDelay == 0) {
@@ -41,7 +41,7 @@ private:
 	vector<unique_ptr<IMemoryHandler>> _gsuCpuRamHandlers;
 	vector<unique_ptr<IMemoryHandler>> _gsuCpuRomHandlers;
 
-	void Exec();
+	template<bool debuggerEnabled> void Exec();
 
 	void InitProgramCache(uint16_t cacheAddr);
 
@@ -66,7 +66,16 @@ private:
 	uint8_t ReadRomBuffer();
 	uint8_t ReadRamBuffer(uint16_t addr);
 	void WriteRam(uint16_t addr, uint8_t value);
-	void Step(uint64_t cycles);
+	void ProcessPendingAccess(uint64_t cycles);
+
+	__forceinline void Step(uint64_t cycles)
+	{
+		_state.CycleCount += cycles;
+		if(_state.RomDelay | _state.RamDelay) {
+			//Only needed while a ROM buffer read or RAM buffer write is pending
+			ProcessPendingAccess(cycles);
+		}
+	}
 
 	void STOP();
 	void NOP();
@@ -25,20 +25,14 @@ Msu1::Msu1(Emulator* emu, VirtualFile& romFile, Spc* spc)
 	_spc = spc;
 	_romFolder = romFile.GetFolderPath();
 	_romName = FolderUtilities::GetFilename(romFile.GetFileName(), false);
-	_dataFile.open(FolderUtilities::CombinePath(_romFolder, _romName) + ".msu", ios::binary);
-	if(_dataFile) {
+	if(_dataFile.Open(FolderUtilities::CombinePath(_romFolder, _romName) + ".msu")) {
 		_trackPath = FolderUtilities::CombinePath(_romFolder, _romName);
 	} else {
-		_dataFile.open(FolderUtilities::CombinePath(_romFolder, "msu1.rom"), ios::binary);
+		_dataFile.Open(FolderUtilities::CombinePath(_romFolder, "msu1.rom"));
 		_trackPath = FolderUtilities::CombinePath(_romFolder, "track");
 	}
 
-	if(_dataFile) {
-		_dataFile.seekg(0, ios::end);
-		_dataSize = (uint32_t)_dataFile.tellg();
-	} else {
-		_dataSize = 0;
-	}
+	_dataSize = _dataFile.GetSize();
 
 	_emu->GetSoundMixer()->RegisterAudioProvider(this);
 }
@@ -57,7 +51,7 @@ void Msu1::Write(uint16_t addr, uint8_t value)
 		case 0x2003:
 			_tmpDataPointer = (_tmpDataPointer & 0x00FFFFFF) | (value << 24);
 			_dataPointer = _tmpDataPointer;
-			_dataFile.seekg(_dataPointer, ios::beg);
+			_dataFile.Seek(_dataPointer);
 			break;
 
 		case 0x2004: _trackSelect = (_trackSelect & 0xFF00) | value; break;
@@ -88,7 +82,7 @@ uint8_t Msu1::Read(uint16_t addr)
 			//data
 			if(!_dataBusy && _dataPointer < _dataSize) {
 				_dataPointer++;
-				return (uint8_t)_dataFile.get();
+				return _dataFile.ReadByte();
 			}
 			return 0;
 
@@ -123,7 +117,7 @@ void Msu1::Serialize(Serializer &s)
 	uint32_t offset = _pcmReader.GetOffset();
 	SV(_trackSelect); SV(_tmpDataPointer); SV(_dataPointer); SV(_repeat); SV(_paused); SV(_volume); SV(_trackMissing); SV(_audioBusy); SV(_dataBusy); SV(offset);
 	if(!s.IsSaving()) {
-		_dataFile.seekg(_dataPointer, ios::beg);
+		_dataFile.Seek(_dataPointer);
 		LoadTrack(offset);
 	}
 }
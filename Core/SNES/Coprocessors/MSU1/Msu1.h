@@ -4,6 +4,7 @@
 #include "Shared/Audio/PcmReader.h"
 #include "Utilities/ISerializable.h"
 #include "Utilities/VirtualFile.h"
+#include "Utilities/AsyncStreamReader.h"
 
 class Spc;
 class Emulator;
@@ -28,7 +29,7 @@ private:
 	bool _dataBusy = false; //Always false
 	bool _trackMissing = false;
 
-	ifstream _dataFile;
+	AsyncStreamReader _dataFile;
 	uint32_t _dataSize;
 	
 	void LoadTrack(uint32_t startOffset = 8);
@@ -499,13 +499,25 @@ void Sa1::Run()
 {
 	uint64_t targetCycle = _memoryManager->GetMasterClock() / 2;
 
-	while(_cpu->GetCycleCount() < targetCycle) {
-		if(_state.Sa1Wait || _state.Sa1Reset) {
-			_cpu->IncreaseCycleCount<1>();
-		} else if(_state.DmaRunning) {
-			RunDma();
-		} else {
-			_cpu->Exec();
+	if(_emu->IsDebugging()) {
+		while(_cpu->GetCycleCount() < targetCycle) {
+			if(_state.Sa1Wait || _state.Sa1Reset) {
+				_cpu->IncreaseCycleCount<1>();
+			} else if(_state.DmaRunning) {
+				RunDma();
+			} else {
+				_cpu->Exec<true>();
+			}
+		}
+	} else {
+		while(_cpu->GetCycleCount() < targetCycle) {
+			if(_state.Sa1Wait || _state.Sa1Reset) {
+				_cpu->IncreaseCycleCount<1>();
+			} else if(_state.DmaRunning) {
+				RunDma();
+			} else {
+				_cpu->Exec<false>();
+			}
 		}
 	}
 }
@@ -24,13 +24,16 @@ Sa1Cpu::~Sa1Cpu()
 {
 }
 
+template<bool debuggerEnabled>
 void Sa1Cpu::Exec()
 {
 	_immediateMode = false;
 	_readWriteMask = 0xFFFFFF;
 
 	if(_state.StopState == SnesCpuStopState::Running) {
-		_emu->ProcessInstruction<CpuType::Sa1>();
+		if constexpr(debuggerEnabled) {
+			_emu->ProcessInstruction<CpuType::Sa1>();
+		}
 		RunOp();
 		CheckForInterrupts();
 	} else {
@@ -178,4 +181,7 @@ uint16_t Sa1Cpu::GetResetVector()
 void Sa1Cpu::IncreaseCycleCount(uint64_t cycleCount)
 {
 	_state.CycleCount += cycleCount;
-}
\ No newline at end of file
+}
+
+template void Sa1Cpu::Exec<true>();
+template void Sa1Cpu::Exec<false>();
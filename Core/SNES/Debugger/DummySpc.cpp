@@ -37,7 +37,7 @@ void DummySpc::SetDummyState(SpcState& state)
 void DummySpc::Step()
 {
 	do {
-		ProcessCycle();
+		ProcessCycle<false>();
 	} while(_opStep != SpcOpStep::ReadOpCode);
 }
 
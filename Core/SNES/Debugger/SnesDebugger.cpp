@@ -179,7 +179,7 @@ void SnesDebugger::ProcessInstruction()
 	
 	if(_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _predictiveBreakpoints) {
 		_dummyCpu->SetDummyState(state);
-		_dummyCpu->Exec();
+		_dummyCpu->Exec<false>();
 		for(uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
 			MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
 			if(_breakpointManager->HasBreakpointForType(memOp.Type)) {
@@ -117,7 +117,7 @@ EffectiveAddressInfo SnesDisUtils::GetEffectiveAddress(DisassemblyInfo &info, Sn
 	state.PS &= ~(ProcFlags::IndexMode8 | ProcFlags::MemoryMode8);
 	state.PS |= info.GetFlags();
 	dummyCpu.SetDummyState(state);
-	dummyCpu.Exec();
+	dummyCpu.Exec<false>();
 
 	bool isJump = SnesDisUtils::IsUnconditionalJump(info.GetOpCode()) || SnesDisUtils::IsConditionalJump(info.GetOpCode());
 	if(isJump) {
@@ -75,16 +75,19 @@ void InternalRegisters::ProcessIrqCounters()
 		}
 	}
 
-	bool irqLevel = (
-		(_state.EnableHorizontalIrq || _state.EnableVerticalIrq) &&
-		(!_state.EnableHorizontalIrq || (_state.HorizontalTimer <= 339 && (_ppu->GetCycle() == _state.HorizontalTimer) && (_ppu->GetLastScanline() != _ppu->GetRealScanline() || _state.HorizontalTimer < 339))) &&
-		(!_state.EnableVerticalIrq || _ppu->GetRealScanline() == _state.VerticalTimer)
-	);
-
-	if(!_irqLevel && irqLevel) {
-		//Trigger IRQ signal 16 master clocks later
-		_needIrq = 4;
+	if(_irqLevel || _state.EnableHorizontalIrq || _state.EnableVerticalIrq) {
+		//Only check the H/V counters when an IRQ is enabled (or the IRQ line needs to be cleared)
+		bool irqLevel = (
+			(_state.EnableHorizontalIrq || _state.EnableVerticalIrq) &&
+			(!_state.EnableHorizontalIrq || (_state.HorizontalTimer <= 339 && (_ppu->GetCycle() == _state.HorizontalTimer) && (_ppu->GetLastScanline() != _ppu->GetRealScanline() || _state.HorizontalTimer < 339))) &&
+			(!_state.EnableVerticalIrq || _ppu->GetRealScanline() == _state.VerticalTimer)
+		);
+
+		if(!_irqLevel && irqLevel) {
+			//Trigger IRQ signal 16 master clocks later
+			_needIrq = 4;
+		}
+		_irqLevel = irqLevel;
 	}
-	_irqLevel = irqLevel;
 	_cpu->SetNmiFlag(_state.EnableNmi & _nmiFlag);
 }
\ No newline at end of file
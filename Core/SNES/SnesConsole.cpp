@@ -61,8 +61,14 @@ void SnesConsole::RunFrame()
 
 	_frameRunning = true;
 
-	while(_frameRunning) {
-		_cpu->Exec();
+	if(_emu->IsDebugging()) {
+		while(_frameRunning) {
+			_cpu->Exec<true>();
+		}
+	} else {
+		while(_frameRunning) {
+			_cpu->Exec<false>();
+		}
 	}
 
 	_spc->ProcessEndFrame();
@@ -78,7 +84,7 @@ void SnesConsole::ProcessEndOfFrame()
 	_emu->ProcessEndOfFrame();
 
 	_controlManager->UpdateControlDevices();
-	_controlManager->UpdateInputState();
+	_controlManager->UpdateInputStateForNextFrame();
 	_internalRegisters->SetAutoJoypadReadClock();
 	_frameRunning = false;
 }
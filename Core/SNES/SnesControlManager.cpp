@@ -87,6 +87,8 @@ void SnesControlManager::UpdateControlDevices()
 
 uint8_t SnesControlManager::Read(uint16_t addr, bool forAutoRead)
 {
+	LatchInput();
+
 	if(!forAutoRead) {
 		_console->GetInternalRegisters()->ProcessAutoJoypad();
 		SetInputReadFlag();
@@ -102,6 +104,9 @@ uint8_t SnesControlManager::Read(uint16_t addr, bool forAutoRead)
 
 void SnesControlManager::Write(uint16_t addr, uint8_t value, bool forAutoRead)
 {
+	//Also called by the auto-joypad read, before it strobes the controllers
+	LatchInput();
+
 	if(!forAutoRead) {
 		_lastWriteValue = value;
 	}
@@ -26,6 +26,7 @@ SnesCpu::~SnesCpu()
 {
 }
 
+template<bool debuggerEnabled>
 void SnesCpu::Exec()
 {
 	_immediateMode = false;
@@ -33,12 +34,19 @@ void SnesCpu::Exec()
 
 	if(_state.StopState == SnesCpuStopState::Running) {
 #ifndef DUMMYCPU
-		_emu->ProcessInstruction<CpuType::Snes>();
+		if constexpr(debuggerEnabled) {
+			_emu->ProcessInstruction<CpuType::Snes>();
+		}
 #endif
 
 		RunOp();
 		CheckForInterrupts();
 	} else {
+#ifndef DUMMYCPU
+		if constexpr(debuggerEnabled) {
+			_emu->ProcessHaltedCpu<CpuType::Snes>();
+		}
+#endif
 		ProcessHaltedState();
 	}
 }
@@ -63,10 +71,6 @@ void SnesCpu::CheckForInterrupts()
 
 void SnesCpu::ProcessHaltedState()
 {
-#ifndef DUMMYCPU
-	_emu->ProcessHaltedCpu<CpuType::Snes>();
-#endif
-
 	if(_state.StopState == SnesCpuStopState::Stopped) {
 		//STP was executed, CPU no longer executes any code
 #ifndef DUMMYCPU
@@ -158,3 +162,6 @@ void SnesCpu::Write(uint32_t addr, uint8_t value, MemoryOperationType type)
 	UpdateIrqNmiFlags();
 }
 #endif
+
+template void SnesCpu::Exec<true>();
+template void SnesCpu::Exec<false>();
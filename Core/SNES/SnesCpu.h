@@ -339,7 +339,7 @@ public:
 	void PowerOn();
 
 	void Reset();
-	void Exec();
+	template<bool debuggerEnabled> void Exec();
 
 	SnesCpuState& GetState();
 	uint64_t GetCycleCount();
@@ -385,16 +385,25 @@ void Spc::Run()
 	}
 
 	uint64_t targetCycle = (uint64_t)(_memoryManager->GetMasterClock() * _clockRatio);
-	while(_state.Cycle < targetCycle) {
-		ProcessCycle();
+	if(_emu->IsDebugging()) {
+		while(_state.Cycle < targetCycle) {
+			ProcessCycle<true>();
+		}
+	} else {
+		while(_state.Cycle < targetCycle) {
+			ProcessCycle<false>();
+		}
 	}
 }
 
+template<bool debuggerEnabled>
 void Spc::ProcessCycle()
 {
 	if(_opStep == SpcOpStep::ReadOpCode) {
 #ifndef DUMMYSPC
-		_emu->ProcessInstruction<CpuType::Spc>();
+		if constexpr(debuggerEnabled) {
+			_emu->ProcessInstruction<CpuType::Spc>();
+		}
 #endif 
 		_opCode = GetOpCode();
 		_opStep = SpcOpStep::Addressing;
@@ -281,7 +281,7 @@ private:
 	void IncCycleCount(int32_t addr);
 	void EndOp();
 	void EndAddr();
-	void ProcessCycle();
+	template<bool debuggerEnabled> void ProcessCycle();
 	void Exec();
 	
 	void UpdateClockRatio();
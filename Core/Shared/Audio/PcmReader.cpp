@@ -17,23 +17,19 @@ PcmReader::~PcmReader()
 
 bool PcmReader::Init(string filename, bool loop, uint32_t startOffset)
 {
-	if(_file) {
-		_file.close();
-	}
-
-	_file.open(filename, ios::binary);
-	if(_file) {
-		_file.seekg(0, ios::end);
-		_fileSize = (uint32_t)_file.tellg();
+	if(_file.Open(filename)) {
+		_fileSize = _file.GetSize();
 		if(_fileSize < 12) {
+			_file.Close();
+			_done = true;
 			return false;
 		}
 
-		_file.seekg(4, ios::beg);
-		uint32_t loopOffset = (uint8_t)_file.get();
-		loopOffset |= ((uint8_t)_file.get()) << 8;
-		loopOffset |= ((uint8_t)_file.get()) << 16;
-		loopOffset |= ((uint8_t)_file.get()) << 24;
+		_file.Seek(4);
+		uint32_t loopOffset = _file.ReadByte();
+		loopOffset |= _file.ReadByte() << 8;
+		loopOffset |= _file.ReadByte() << 16;
+		loopOffset |= _file.ReadByte() << 24;
 
 		_loopOffset = (uint32_t)loopOffset;
 
@@ -42,7 +38,7 @@ bool PcmReader::Init(string filename, bool loop, uint32_t startOffset)
 		_done = false;
 		_loop = loop;
 		_fileOffset = startOffset;
-		_file.seekg(_fileOffset, ios::beg);
+		_file.Seek(_fileOffset);
 
 		_leftoverSampleCount = 0;
 		_pcmBuffer.clear();
@@ -74,45 +70,45 @@ void PcmReader::SetLoopFlag(bool loop)
 	_loop = loop;
 }
 
-void PcmReader::ReadSample(int16_t &left, int16_t &right)
-{
-	uint8_t val[4];
-	_file.get(((char*)val)[0]);
-	_file.get(((char*)val)[1]);
-	_file.get(((char*)val)[2]);
-	_file.get(((char*)val)[3]);
-
-	left = val[0] | (val[1] << 8);
-	right = val[2] | (val[3] << 8);
-}
-
 void PcmReader::LoadSamples(uint32_t samplesToLoad)
 {
 	uint32_t samplesRead = 0;
 
-	int16_t left = 0;
-	int16_t right = 0;
-	for(uint32_t i = _fileOffset; i < _fileSize && samplesRead < samplesToLoad; i+=4) {
-		ReadSample(left, right);
+	while(samplesRead < samplesToLoad) {
+		if(_fileOffset + 4 > _fileSize) {
+			uint32_t loopStart = _loopOffset * 4 + 8;
+			if(_loop && loopStart + 4 <= _fileSize) {
+				_fileOffset = loopStart;
+				_file.Seek(_fileOffset);
+			} else {
+				_done = true;
+				break;
+			}
+		}
 
-		_pcmBuffer.push_back(left);
-		_pcmBuffer.push_back(right);
+		//Read as many samples as possible in a single call, the data is already prefetched by the stream reader
+		uint32_t count = std::min(samplesToLoad - samplesRead, (_fileSize - _fileOffset) / 4);
+		_readBuffer.resize(count * 4);
+		count = _file.Read(_readBuffer.data(), count * 4) / 4;
+		if(count == 0) {
+			_done = true;
+			break;
+		}
 
-		_prevLeft = left;
-		_prevRight = right;
+		for(uint32_t i = 0; i < count; i++) {
+			uint8_t* val = _readBuffer.data() + i * 4;
+			int16_t left = val[0] | (val[1] << 8);
+			int16_t right = val[2] | (val[3] << 8);
 
-		_fileOffset += 4;
-		samplesRead++;
+			_pcmBuffer.push_back(left);
+			_pcmBuffer.push_back(right);
 
-		if(samplesRead < samplesToLoad && i + 4 >= _fileSize) {
-			if(_loop) {
-				i = _loopOffset * 4 + 8;
-				_fileOffset = i;
-				_file.seekg(_fileOffset, ios::beg);
-			} else {
-				_done = true;
-			}
+			_prevLeft = left;
+			_prevRight = right;
 		}
+
+		_fileOffset += count * 4;
+		samplesRead += count;
 	}
 }
 
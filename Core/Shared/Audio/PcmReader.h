@@ -2,16 +2,16 @@
 #include "pch.h"
 #include "Utilities/Audio/stb_vorbis.h"
 #include "Utilities/Audio/HermiteResampler.h"
+#include "Utilities/AsyncStreamReader.h"
 
 class PcmReader
 {
 private:
 	static constexpr int PcmSampleRate = 44100;
-	static constexpr int SamplesToRead = 100;
-
 	int16_t* _outputBuffer = nullptr;
 
-	ifstream _file;
+	AsyncStreamReader _file;
+	vector<uint8_t> _readBuffer;
 	uint32_t _fileOffset = 0;
 	uint32_t _fileSize = 0;
 	uint32_t _loopOffset = 0;
@@ -29,7 +29,6 @@ private:
 	uint32_t _sampleRate = 0;
 
 	void LoadSamples(uint32_t samplesToLoad);
-	void ReadSample(int16_t &left, int16_t &right);
 
 public:
 	PcmReader();
@@ -3,6 +3,7 @@
 #include "Shared/Audio/AudioPlayerHud.h"
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
+#include "Shared/PerformanceCounters.h"
 #include "Shared/Audio/SoundResampler.h"
 #include "Shared/RewindManager.h"
 #include "Shared/Video/VideoRenderer.h"
@@ -69,6 +70,7 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 		return;
 	}
 
+	PerfTimer perfTimer(_emu->GetPerformanceCounters(), PerfCounter::AudioMixing);
 	EmuSettings* settings = _emu->GetSettings();
 	AudioPlayerHud* audioPlayer = _emu->GetAudioPlayerHud();
 	AudioConfig cfg = settings->GetAudioConfig();
@@ -79,6 +79,13 @@ ControlDeviceState BaseControlDevice::GetRawState()
 	return _state;
 }
 
+void BaseControlDevice::GetRawState(ControlDeviceState& state)
+{
+	//Reuses the buffer of the given state to avoid allocating a new one every frame
+	auto lock = _stateLock.AcquireSafe();
+	state.State.assign(_state.State.begin(), _state.State.end());
+}
+
 void BaseControlDevice::DrawController(InputHud& hud)
 {
 	InputConfig& cfg = _emu->GetSettings()->GetInputConfig();
@@ -89,9 +96,14 @@ void BaseControlDevice::DrawController(InputHud& hud)
 }
 
 void BaseControlDevice::SetRawState(ControlDeviceState state)
+{
+	SetRawState(state.State.data(), (uint32_t)state.State.size());
+}
+
+void BaseControlDevice::SetRawState(const uint8_t* state, uint32_t size)
 {
 	auto lock = _stateLock.AcquireSafe();
-	_state = state;
+	_state.State.assign(state, state + size);
 }
 
 void BaseControlDevice::SetTextState(string textState)
@@ -90,8 +90,10 @@ public:
 	void SetStateFromInput();
 	virtual void OnAfterSetState() { }
 	
-	virtual void SetRawState(ControlDeviceState state);
+	void SetRawState(ControlDeviceState state);
+	virtual void SetRawState(const uint8_t* state, uint32_t size);
 	virtual ControlDeviceState GetRawState();
+	void GetRawState(ControlDeviceState& state);
 
 	virtual void InternalDrawController(InputHud& hud) {}
 	virtual void DrawController(InputHud& hud);
@@ -138,6 +138,7 @@ vector<shared_ptr<BaseControlDevice>> BaseControlManager::GetControlDevices()
 void BaseControlManager::Serialize(Serializer& s)
 {
 	SV(_pollCounter);
+	SV(_inputLatchPending);
 }
 
 void BaseControlManager::RegisterControlDevice(shared_ptr<BaseControlDevice> controlDevice)
@@ -157,6 +158,8 @@ void BaseControlManager::ClearDevices()
 
 void BaseControlManager::UpdateInputState()
 {
+	_inputLatchPending = false;
+
 	KeyManager::RefreshKeyState();
 
 	auto lock = _deviceLock.AcquireSafe();
@@ -190,6 +193,19 @@ void BaseControlManager::UpdateInputState()
 	_pollCounter++;
 }
 
+void BaseControlManager::UpdateInputStateForNextFrame()
+{
+	//The game didn't read the input during this frame, poll it now to keep polling the input once per frame
+	LatchInput();
+
+	EmulationConfig& cfg = _emu->GetSettings()->GetEmulationConfig();
+	if(cfg.LateInputLatching && cfg.RunAheadFrames == 0 && CanDelayInputLatch()) {
+		_inputLatchPending = true;
+	} else {
+		UpdateInputState();
+	}
+}
+
 void BaseControlManager::ProcessEndOfFrame()
 {
 	if(!_wasInputRead) {
@@ -202,6 +218,7 @@ void BaseControlManager::SetInputReadFlag()
 {
 	//Used for lag counter - any frame where the input is read does not count as lag
 	_wasInputRead = true;
+	LatchInput();
 }
 
 uint32_t BaseControlManager::GetLagCounter()
@@ -27,11 +27,15 @@ protected:
 	uint32_t _pollCounter = 0;
 	uint32_t _lagCounter = 0;
 	bool _wasInputRead = false;
+	bool _inputLatchPending = false;
 
 	void RegisterControlDevice(shared_ptr<BaseControlDevice> controlDevice);
 
 	void ClearDevices();
 
+	//Returns false when the console can react to input changes without the game reading the controllers (e.g keypad IRQs)
+	virtual bool CanDelayInputLatch() { return true; }
+
 public:
 	BaseControlManager(Emulator* emu, CpuType cpuType);
 	virtual ~BaseControlManager();
@@ -43,6 +47,17 @@ public:
 	virtual void UpdateControlDevices() {}
 	virtual void UpdateInputState();
 
+	//Polls the input for the next frame - with late input latching, this is delayed until the game reads the controllers
+	void UpdateInputStateForNextFrame();
+
+	//Polls the input if it was delayed by UpdateInputStateForNextFrame (called before the controllers are read/strobed)
+	__forceinline void LatchInput()
+	{
+		if(_inputLatchPending) {
+			UpdateInputState();
+		}
+	}
+
 	void ProcessEndOfFrame();
 
 	void SetInputReadFlag();
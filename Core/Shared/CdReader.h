@@ -118,6 +118,15 @@ struct DiscInfo
 
 	template<typename T>
 	void ReadDataSector(uint32_t sector, T& outData)
+	{
+		uint8_t rawSector[DiscInfo::SectorSize];
+		ReadRawSector(sector, rawSector);
+		ExtractDataSector(sector, rawSector, outData);
+	}
+
+	//Appends the 2048 bytes of data contained in a raw sector (as returned by ReadRawSector) to outData
+	template<typename T>
+	void ExtractDataSector(uint32_t sector, uint8_t* rawSector, T& outData)
 	{
 		constexpr int Mode1_2352_SectorHeaderSize = 16;
 
@@ -127,14 +136,34 @@ struct DiscInfo
 			LogDebug("Invalid sector/track (or inside pregap)");
 			outData.insert(outData.end(), 2048, 0);
 		} else {
-			TrackInfo& trk = Tracks[track];
-			uint32_t sectorSize = trk.GetSectorSize();
-			uint32_t sectorHeaderSize = trk.Format == TrackFormat::Mode1_2352 ? Mode1_2352_SectorHeaderSize : 0;
-			uint32_t byteOffset = trk.FileOffset + (sector - trk.FirstSector) * sectorSize;
-			if(!Files[trk.FileIndex].ReadChunk(outData, byteOffset + sectorHeaderSize, 2048)) {
-				LogDebug("Invalid read offsets");
+			uint32_t sectorHeaderSize = Tracks[track].Format == TrackFormat::Mode1_2352 ? Mode1_2352_SectorHeaderSize : 0;
+			outData.insert(outData.end(), rawSector + sectorHeaderSize, rawSector + sectorHeaderSize + 2048);
+		}
+	}
+
+	bool ReadRawSector(uint32_t sector, uint8_t* outData)
+	{
+		int32_t track = GetTrack(sector);
+		if(track < 0) {
+			return false;
+		}
+
+		TrackInfo& trk = Tracks[track];
+		uint32_t sectorSize = trk.GetSectorSize();
+		uint32_t byteOffset = trk.FileOffset + (sector - trk.FirstSector) * sectorSize;
+		const uint8_t* data = Files[trk.FileIndex].GetSpan(byteOffset, sectorSize);
+		if(data) {
+			memcpy(outData, data, sectorSize);
+		} else {
+			for(uint32_t i = 0; i < sectorSize; i++) {
+				outData[i] = Files[trk.FileIndex].ReadByte(byteOffset + i);
 			}
 		}
+
+		if(sectorSize < DiscInfo::SectorSize) {
+			memset(outData + sectorSize, 0, DiscInfo::SectorSize - sectorSize);
+		}
+		return true;
 	}
 
 	int16_t ReadAudioSample(uint32_t sector, uint32_t sample, uint32_t byteOffset)
@@ -147,7 +176,12 @@ struct DiscInfo
 
 		uint32_t fileIndex = Tracks[track].FileIndex;
 		uint32_t startByte = Tracks[track].FileOffset + (sector - Tracks[track].FirstSector) * DiscInfo::SectorSize;
-		return (int16_t)(Files[fileIndex].ReadByte(startByte + sample * 4 + byteOffset) | (Files[fileIndex].ReadByte(startByte + sample * 4 + 1 + byteOffset) << 8));
+		uint32_t offset = startByte + sample * 4 + byteOffset;
+		const uint8_t* data = Files[fileIndex].GetSpan(offset, 2);
+		if(data) {
+			return (int16_t)(data[0] | (data[1] << 8));
+		}
+		return (int16_t)(Files[fileIndex].ReadByte(offset) | (Files[fileIndex].ReadByte(offset + 1) << 8));
 	}
 
 	int16_t ReadLeftSample(uint32_t sector, uint32_t sample)
@@ -0,0 +1,125 @@
+#include "pch.h"
+#include "Shared/CdSectorCache.h"
+
+CdSectorCache::CdSectorCache(DiscInfo& disc)
+{
+	_disc = &disc;
+	_stopFlag = false;
+	if(_disc->Files.size() > 0) {
+		_cache.resize(CdSectorCache::CacheSize);
+		_thread.reset(new thread(&CdSectorCache::ReadThread, this));
+	}
+}
+
+CdSectorCache::~CdSectorCache()
+{
+	if(_thread) {
+		{
+			std::unique_lock<std::mutex> lock(_cacheLock);
+			_stopFlag = true;
+		}
+		_signal.notify_all();
+		_thread->join();
+	}
+}
+
+void CdSectorCache::LoadSector(uint32_t sector, uint8_t* dst)
+{
+	//VirtualFile is not thread-safe, all disc accesses go through this lock
+	std::lock_guard<std::mutex> lock(_fileLock);
+	if(!_disc->ReadRawSector(sector, dst)) {
+		memset(dst, 0, DiscInfo::SectorSize);
+	}
+}
+
+bool CdSectorCache::TryCopy(uint32_t sector, uint8_t* dst)
+{
+	std::lock_guard<std::mutex> lock(_cacheLock);
+	CacheEntry& entry = _cache[sector % CdSectorCache::CacheSize];
+	if(entry.Sector == (int32_t)sector) {
+		memcpy(dst, entry.Data, DiscInfo::SectorSize);
+		return true;
+	}
+	return false;
+}
+
+void CdSectorCache::Insert(uint32_t sector, uint8_t* src)
+{
+	std::lock_guard<std::mutex> lock(_cacheLock);
+	CacheEntry& entry = _cache[sector % CdSectorCache::CacheSize];
+	entry.Sector = (int32_t)sector;
+	memcpy(entry.Data, src, DiscInfo::SectorSize);
+}
+
+void CdSectorCache::Prefetch(uint32_t sector)
+{
+	if(!_thread) {
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_cacheLock);
+		if(_prefetchSector == sector) {
+			return;
+		}
+		_prefetchSector = sector;
+		_prefetchCounter++;
+	}
+	_signal.notify_one();
+}
+
+void CdSectorCache::ReadSector(uint32_t sector, uint8_t* dst)
+{
+	if(_thread) {
+		//Keep the worker thread ahead of the read position
+		Prefetch(sector + 1);
+
+		if(TryCopy(sector, dst)) {
+			return;
+		}
+	}
+
+	//Cache miss, read the sector synchronously
+	LoadSector(sector, dst);
+	if(_thread) {
+		Insert(sector, dst);
+	}
+}
+
+void CdSectorCache::ReadThread()
+{
+	uint8_t buffer[DiscInfo::SectorSize];
+	uint32_t processedCounter = 0;
+
+	while(true) {
+		uint32_t start;
+		uint32_t counter;
+		{
+			std::unique_lock<std::mutex> lock(_cacheLock);
+			_signal.wait(lock, [&] { return _stopFlag || _prefetchCounter != processedCounter; });
+			if(_stopFlag) {
+				return;
+			}
+			start = _prefetchSector;
+			counter = _prefetchCounter;
+		}
+		processedCounter = counter;
+
+		uint32_t end = std::min<uint32_t>(start + CdSectorCache::ReadAheadSize, _disc->DiscSectorCount);
+		for(uint32_t sector = start; sector < end; sector++) {
+			{
+				std::lock_guard<std::mutex> lock(_cacheLock);
+				if(_stopFlag || _prefetchCounter != counter) {
+					//A new prefetch request was made (e.g seek), stop loading this range
+					break;
+				}
+				if(_cache[sector % CdSectorCache::CacheSize].Sector == (int32_t)sector) {
+					continue;
+				}
+			}
+
+			LoadSector(sector, buffer);
+			Insert(sector, buffer);
+		}
+	}
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "pch.h"
+#include <mutex>
+#include <condition_variable>
+#include "Shared/CdReader.h"
+
+//Loads disc sectors on a worker thread ahead of the emulation's read position.
+//Sector reads on the emulation thread copy from the cache and only fall back to
+//reading from the disc image directly when the sector has not been prefetched yet.
+class CdSectorCache
+{
+private:
+	static constexpr int CacheSize = 512; //~1.2mb, ~7 seconds of audio
+	static constexpr int ReadAheadSize = 150; //2 seconds' worth of sectors
+
+	struct CacheEntry
+	{
+		int32_t Sector = -1;
+		uint8_t Data[DiscInfo::SectorSize] = {};
+	};
+
+	DiscInfo* _disc = nullptr;
+	vector<CacheEntry> _cache;
+
+	std::mutex _cacheLock;
+	std::mutex _fileLock;
+	std::condition_variable _signal;
+
+	unique_ptr<thread> _thread;
+	atomic<bool> _stopFlag;
+
+	uint32_t _prefetchSector = 0;
+	uint32_t _prefetchCounter = 0;
+
+	void ReadThread();
+	void LoadSector(uint32_t sector, uint8_t* dst);
+	bool TryCopy(uint32_t sector, uint8_t* dst);
+	void Insert(uint32_t sector, uint8_t* src);
+
+public:
+	CdSectorCache(DiscInfo& disc);
+	~CdSectorCache();
+
+	//Starts loading the sectors that follow "sector" on the worker thread (does not block)
+	void Prefetch(uint32_t sector);
+
+	//Copies the sector's raw content (DiscInfo::SectorSize bytes) to "dst"
+	void ReadSector(uint32_t sector, uint8_t* dst);
+
+	//Same as DiscInfo::ReadDataSector, but reads the raw sector from the cache
+	template<typename T>
+	void ReadDataSector(uint32_t sector, T& outData)
+	{
+		uint8_t data[DiscInfo::SectorSize];
+		ReadSector(sector, data);
+		_disc->ExtractDataSector(sector, data, outData);
+	}
+};
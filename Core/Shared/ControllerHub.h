@@ -140,25 +140,24 @@ public:
 		return state;
 	}
 
-	void SetRawState(ControlDeviceState state) override
+	using BaseControlDevice::SetRawState;
+
+	void SetRawState(const uint8_t* state, uint32_t size) override
 	{
 		auto lock = _stateLock.AcquireSafe();
-		_state = state;
+		_state.State.assign(state, state + size);
 
-		vector<uint8_t> data = state.State;
-		int pos = 0;
+		uint32_t pos = 0;
 
 		for(int i = 0; i < HubPortCount; i++) {
-			if(_ports[i] && pos < data.size()) {
-				int length = data[pos++];
+			if(_ports[i] && pos < size) {
+				uint32_t length = state[pos++];
 
-				if(pos + length > data.size()) {
+				if(pos + length > size) {
 					break;
 				}
 
-				ControlDeviceState portState;
-				portState.State.insert(portState.State.begin(), data.begin() + pos, data.begin() + pos + length);
-				_ports[i]->SetRawState(portState);
+				_ports[i]->SetRawState(state + pos, length);
 				pos += length;
 			}
 		}
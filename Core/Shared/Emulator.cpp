@@ -1,5 +1,6 @@
 #include "pch.h"
 #include <assert.h>
+#include <future>
 #include "Shared/Emulator.h"
 #include "Shared/NotificationManager.h"
 #include "Shared/Audio/SoundMixer.h"
@@ -8,6 +9,8 @@
 #include "Shared/Video/VideoRenderer.h"
 #include "Shared/Video/DebugHud.h"
 #include "Shared/FrameLimiter.h"
+#include "Shared/FrameTimingStats.h"
+#include "Shared/PerformanceCounters.h"
 #include "Shared/MessageManager.h"
 #include "Shared/KeyManager.h"
 #include "Shared/EmuSettings.h"
@@ -57,6 +60,8 @@ Emulator::Emulator() :
 	_notificationManager(new NotificationManager()),
 	_batteryManager(new BatteryManager()),
 	_soundMixer(new SoundMixer(this)),
+	_frameTimings(new FrameTimingStats()),
+	_perfCounters(new PerformanceCounters()),
 	_videoRenderer(new VideoRenderer(this)),
 	_videoDecoder(new VideoDecoder(this)),
 	_saveStateManager(new SaveStateManager(this)),
@@ -99,6 +104,7 @@ void Emulator::Initialize(bool enableShortcuts)
 void Emulator::Release()
 {
 	Stop(true);
+	_saveStateManager->WaitForPendingSaves();
 
 	_gameClient->Disconnect();
 	_gameServer->StopServer();
@@ -131,7 +137,10 @@ void Emulator::Run()
 	_frameDelay = GetFrameDelay();
 	_stats.reset(new DebugStats());
 	_frameLimiter.reset(new FrameLimiter(_frameDelay));
+	_frameTimings->Reset();
+	_perfCounters->Reset();
 	_lastFrameTimer.Reset();
+	_frameStageTimer.Reset();
 
 	while(!_stopFlag) {
 		bool useRunAhead = _settings->GetEmulationConfig().RunAheadFrames > 0 && !_debugger && !_audioPlayerHud && !_rewindManager->IsRewinding() && _settings->GetEmulationSpeed() > 0 && _settings->GetEmulationSpeed() <= 100;
@@ -251,7 +260,13 @@ void Emulator::OnBeforeSendFrame()
 void Emulator::ProcessEndOfFrame()
 {
 	if(!_isRunAheadFrame) {
-		_frameLimiter->ProcessFrame();
+		double emulationTime = _frameStageTimer.GetElapsedMS();
+		bool validTiming = _frameLimiter->ProcessFrame();
+		if(validTiming) {
+			_perfCounters->AddTime(PerfCounter::Emulation, (uint64_t)(emulationTime * 1000000));
+		}
+		_perfCounters->EndFrame(GetFrameCount());
+
 		while(_frameLimiter->WaitForNextFrame()) {
 			if(_stopFlag || _frameDelay != GetFrameDelay() || _paused || _pauseOnNextFrame || _lockCounter > 0) {
 				//Need to process another event, stop sleeping
@@ -259,6 +274,13 @@ void Emulator::ProcessEndOfFrame()
 			}
 		}
 
+		if(validTiming) {
+			//The input for the next frame is polled after this point, so the time spent waiting does not add to the input latency
+			_frameTimings->AddSample(FrameStage::Emulation, emulationTime);
+			_frameTimings->AddSample(FrameStage::Wait, _frameStageTimer.GetElapsedMS() - emulationTime);
+		}
+		_frameStageTimer.Reset();
+
 		double newFrameDelay = GetFrameDelay();
 		if(newFrameDelay != _frameDelay) {
 			_frameDelay = newFrameDelay;
@@ -399,6 +421,14 @@ bool Emulator::InternalLoadRom(VirtualFile romFile, VirtualFile patchFile, bool
 	//Unset _debugger to ensure nothing calls the debugger while initializing the new rom
 	ResetDebugger();
 
+	//Hash the original (unpatched) file on another thread while the rom is being patched and loaded
+	//Load (and decompress) the file before copying it, so the copy used for hashing doesn't need to load it again
+	romFile.LoadFile();
+	VirtualFile hashFile = romFile;
+
+	//The future's destructor waits for the hashing to end, even if loading the rom throws an exception
+	std::future<void> hashTask = std::async(std::launch::async, [&hashFile]() { hashFile.CalculateHashes(); });
+
 	if(patchFile.IsValid()) {
 		if(romFile.ApplyPatch(patchFile)) {
 			MessageManager::DisplayMessage("Patch", "ApplyingPatch", patchFile.GetFileName());
@@ -424,6 +454,8 @@ bool Emulator::InternalLoadRom(VirtualFile romFile, VirtualFile patchFile, bool
 	//Try loading the rom, give priority to file extension, then trying to check for file signatures if extension is unknown
 	TryLoadRom(romFile, result, console, false);
 	TryLoadRom(romFile, result, console, true);
+
+	hashTask.get();
 	
 	if(result != LoadRomResult::Success) {
 		_notificationManager->SendNotification(ConsoleNotificationType::GameLoadFailed);
@@ -455,6 +487,8 @@ bool Emulator::InternalLoadRom(VirtualFile romFile, VirtualFile patchFile, bool
 	//Cast VirtualFiles to string to ensure the original file data isn't kept in memory
 	_rom.RomFile = (string)romFile;
 	_rom.PatchFile = (string)patchFile;
+	_romCrc32 = hashFile.GetCrc32();
+	_romSha1 = hashFile.GetSha1Hash();
 	_rom.Format = console->GetRomFormat();
 	_rom.DipSwitches = console->GetDipSwitchInfo();
 
@@ -593,16 +627,16 @@ string Emulator::GetHash(HashType type)
 	if(hash.size()) {
 		return hash;
 	} else if(type == HashType::Sha1) {
-		return _rom.RomFile.GetSha1Hash();
+		return _romSha1;
 	} else if(type == HashType::Sha1Cheat) {
-		return _rom.RomFile.GetSha1Hash();
+		return _romSha1;
 	}
 	return "";
 }
 
 uint32_t Emulator::GetCrc32()
 {
-	return _rom.RomFile.GetCrc32();
+	return _romCrc32;
 }
 
 PpuFrameInfo Emulator::GetPpuFrame()
@@ -25,6 +25,8 @@ class CheatManager;
 class MovieManager;
 class HistoryViewer;
 class FrameLimiter;
+class FrameTimingStats;
+class PerformanceCounters;
 class DebugStats;
 class BaseControlManager;
 class VirtualFile;
@@ -75,6 +77,8 @@ private:
 	const unique_ptr<NotificationManager> _notificationManager;
 	const unique_ptr<BatteryManager> _batteryManager;
 	const unique_ptr<SoundMixer> _soundMixer;
+	const unique_ptr<FrameTimingStats> _frameTimings;
+	const unique_ptr<PerformanceCounters> _perfCounters;
 	const unique_ptr<VideoRenderer> _videoRenderer;
 	const unique_ptr<VideoDecoder> _videoDecoder;
 	const unique_ptr<SaveStateManager> _saveStateManager;
@@ -105,6 +109,8 @@ private:
 	bool _frameRunning = false;
 
 	RomInfo _rom;
+	uint32_t _romCrc32 = 0;
+	string _romSha1;
 	ConsoleType _consoleType = {};
 
 	ConsoleMemoryInfo _consoleMemory[DebugUtilities::GetMemoryTypeCount()] = {};
@@ -112,6 +118,7 @@ private:
 	unique_ptr<DebugStats> _stats;
 	unique_ptr<FrameLimiter> _frameLimiter;
 	Timer _lastFrameTimer;
+	Timer _frameStageTimer;
 	double _frameDelay = 0;
 	
 	uint32_t _autoSaveStateFrameCounter = 0;
@@ -193,6 +200,8 @@ public:
 	RewindManager* GetRewindManager() { return _rewindManager.get(); }
 	DebugHud* GetDebugHud() { return _debugHud.get(); }
 	DebugHud* GetScriptHud() { return _scriptHud.get(); }
+	FrameTimingStats* GetFrameTimings() { return _frameTimings.get(); }
+	PerformanceCounters* GetPerformanceCounters() { return _perfCounters.get(); }
 	BatteryManager* GetBatteryManager() { return _batteryManager.get(); }
 	CheatManager* GetCheatManager() { return _cheatManager.get(); }
 	MovieManager* GetMovieManager() { return _movieManager.get(); }
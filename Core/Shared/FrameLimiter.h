@@ -23,8 +23,10 @@ public:
 		_resetRunTimers = true;
 	}
 
-	void ProcessFrame()
+	//Returns false when the timers had to be reset (the time spent on the previous frame is not meaningful in this case)
+	bool ProcessFrame()
 	{
+		bool wasReset = false;
 		if(_resetRunTimers || (_clockTimer.GetElapsedMS() - _targetTime) > 100) {
 			//Reset the timers, this can happen in 3 scenarios:
 			//1) Target frame rate changed
@@ -34,9 +36,11 @@ public:
 			_clockTimer.Reset();
 			_targetTime = 0;
 			_resetRunTimers = false;
+			wasReset = true;
 		}
 
 		_targetTime += _delay;
+		return !wasReset;
 	}
 
 	bool WaitForNextFrame()
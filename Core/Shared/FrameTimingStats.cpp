@@ -0,0 +1,75 @@
+#include "pch.h"
+#include "Shared/FrameTimingStats.h"
+
+uint32_t FrameTimingHistogram::GetBucket(double duration)
+{
+	return (uint32_t)std::clamp<double>(duration / BucketSize, 0, BucketCount - 1);
+}
+
+void FrameTimingHistogram::AddSample(double duration)
+{
+	if(_sampleCount == WindowSize) {
+		//Remove the oldest sample from the window
+		double oldest = _samples[_sampleIndex];
+		_buckets[GetBucket(oldest)]--;
+		_total -= oldest;
+	} else {
+		_sampleCount++;
+	}
+
+	_samples[_sampleIndex] = duration;
+	_sampleIndex = (_sampleIndex + 1) % WindowSize;
+	_buckets[GetBucket(duration)]++;
+	_total += duration;
+}
+
+void FrameTimingHistogram::Reset()
+{
+	memset(_buckets, 0, sizeof(_buckets));
+	_sampleIndex = 0;
+	_sampleCount = 0;
+	_total = 0;
+}
+
+FrameStageStats FrameTimingHistogram::GetStats() const
+{
+	FrameStageStats stats = {};
+	if(_sampleCount == 0) {
+		return stats;
+	}
+
+	stats.Last = _samples[(_sampleIndex + WindowSize - 1) % WindowSize];
+	stats.Average = _total / _sampleCount;
+
+	uint32_t threshold = (_sampleCount * 95 + 99) / 100;
+	uint32_t count = 0;
+	for(int i = 0; i < BucketCount; i++) {
+		count += _buckets[i];
+		if(count >= threshold) {
+			//Use the bucket's upper bound, to avoid underestimating the time needed
+			stats.Percentile95 = (i + 1) * BucketSize;
+			break;
+		}
+	}
+	return stats;
+}
+
+void FrameTimingStats::AddSample(FrameStage stage, double duration)
+{
+	auto lock = _lock.AcquireSafe();
+	_histograms[(int)stage].AddSample(duration);
+}
+
+void FrameTimingStats::Reset()
+{
+	auto lock = _lock.AcquireSafe();
+	for(FrameTimingHistogram& histogram : _histograms) {
+		histogram.Reset();
+	}
+}
+
+FrameStageStats FrameTimingStats::GetStats(FrameStage stage)
+{
+	auto lock = _lock.AcquireSafe();
+	return _histograms[(int)stage].GetStats();
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "pch.h"
+#include "Utilities/SimpleLock.h"
+
+enum class FrameStage
+{
+	Emulation,
+	Decode,
+	Filter,
+	Present,
+	Wait,
+	Count
+};
+
+struct FrameStageStats
+{
+	double Last;
+	double Average;
+	double Percentile95;
+};
+
+//Keeps the durations of the last WindowSize samples, bucketed to allow percentiles to be calculated without sorting
+class FrameTimingHistogram
+{
+private:
+	static constexpr int WindowSize = 120;
+	static constexpr int BucketCount = 400;
+	static constexpr double BucketSize = 0.1; //in ms, the last bucket contains everything above 40ms
+
+	uint16_t _buckets[BucketCount] = {};
+	double _samples[WindowSize] = {};
+	uint32_t _sampleIndex = 0;
+	uint32_t _sampleCount = 0;
+	double _total = 0;
+
+	static uint32_t GetBucket(double duration);
+
+public:
+	void AddSample(double duration);
+	void Reset();
+
+	FrameStageStats GetStats() const;
+};
+
+//Durations (in ms) of each stage between the start of a frame's emulation and its presentation on the screen
+//Samples are added by the emulation, decode and render threads
+class FrameTimingStats
+{
+private:
+	SimpleLock _lock;
+	FrameTimingHistogram _histograms[(int)FrameStage::Count];
+
+public:
+	void AddSample(FrameStage stage, double duration);
+	void Reset();
+
+	FrameStageStats GetStats(FrameStage stage);
+};
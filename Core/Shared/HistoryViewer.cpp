@@ -177,10 +177,10 @@ bool HistoryViewer::SetInput(BaseControlDevice *device)
 {
 	uint8_t port = device->GetPort();
 	if(_position < _history.size()) {
-		std::deque<ControlDeviceState> &stateData = _history[_position].InputLogs[port];
-		if(_pollCounter < stateData.size()) {
-			ControlDeviceState state = stateData[_pollCounter];
-			device->SetRawState(state);
+		RewindInputLog& inputLog = _history[_position].InputLogs[port];
+		if(_pollCounter < inputLog.GetCount()) {
+			RewindInputState state = inputLog.Get(_pollCounter);
+			device->SetRawState(state.Data, state.Size);
 		}
 	}
 	if(port == 0 && _pollCounter < RewindManager::BufferSize) {
@@ -33,6 +33,10 @@ public:
 	virtual ~IKeyManager() {}
 
 	virtual void RefreshState() = 0;
+
+	//Returns false when the key manager calls KeyManager::NotifyInputChanged() whenever a controller button is pressed or released
+	virtual bool IsPollingRequired() { return true; }
+
 	virtual void UpdateDevices() = 0;
 	virtual bool IsMouseButtonPressed(MouseButton button) = 0;
 	virtual bool IsKeyPressed(uint16_t keyCode) = 0;
@@ -12,6 +12,9 @@ double KeyManager::_xMouseMovement;
 double KeyManager::_yMouseMovement;
 EmuSettings* KeyManager::_settings = nullptr;
 SimpleLock KeyManager::_lock;
+std::mutex KeyManager::_inputChangeLock;
+std::condition_variable KeyManager::_inputChangeSignal;
+uint32_t KeyManager::_inputChangeCounter = 0;
 
 void KeyManager::RegisterKeyManager(IKeyManager* keyManager)
 {
@@ -64,6 +67,30 @@ vector<uint16_t> KeyManager::GetPressedKeys()
 	return vector<uint16_t>();
 }
 
+bool KeyManager::IsPollingRequired()
+{
+	if(_keyManager != nullptr) {
+		return _keyManager->IsPollingRequired();
+	}
+	return true;
+}
+
+void KeyManager::NotifyInputChanged()
+{
+	{
+		std::unique_lock<std::mutex> lock(_inputChangeLock);
+		_inputChangeCounter++;
+	}
+	_inputChangeSignal.notify_all();
+}
+
+uint32_t KeyManager::WaitForInputChange(uint32_t counter, uint32_t timeoutMs)
+{
+	std::unique_lock<std::mutex> lock(_inputChangeLock);
+	_inputChangeSignal.wait_for(lock, std::chrono::milliseconds(timeoutMs), [=] { return _inputChangeCounter != counter; });
+	return _inputChangeCounter;
+}
+
 string KeyManager::GetKeyName(uint16_t keyCode)
 {
 	if(_keyManager != nullptr) {
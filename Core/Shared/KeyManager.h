@@ -2,6 +2,8 @@
 #include "pch.h"
 #include "Shared/Interfaces/IKeyManager.h"
 #include "Utilities/SimpleLock.h"
+#include <mutex>
+#include <condition_variable>
 
 class Emulator;
 class EmuSettings;
@@ -16,6 +18,10 @@ private:
 	static EmuSettings* _settings;
 	static SimpleLock _lock;
 
+	static std::mutex _inputChangeLock;
+	static std::condition_variable _inputChangeSignal;
+	static uint32_t _inputChangeCounter;
+
 public:
 	static void RegisterKeyManager(IKeyManager* keyManager);
 	static void SetSettings(EmuSettings* settings);
@@ -29,6 +35,11 @@ public:
 	static uint16_t GetKeyCode(string keyName);
 
 	static void UpdateDevices();
+
+	static bool IsPollingRequired();
+	static void NotifyInputChanged();
+	//Waits until NotifyInputChanged() is called or the timeout expires - "counter" is the value returned by the previous call
+	static uint32_t WaitForInputChange(uint32_t counter, uint32_t timeoutMs);
 	
 	static void SetMouseMovement(int16_t x, int16_t y);
 	static MouseMovement GetMouseMovement(Emulator* emu, uint32_t mouseSensitivity);
@@ -56,6 +56,7 @@ std::unordered_map<string, string> MessageManager::_enResources = {
 	{ "OverclockEnabled", u8"Overclocking enabled." },
 	{ "OverclockDisabled", u8"Overclocking disabled." },
 	{ "PrgSizeWarning", u8"PRG size is smaller than 32kb" },
+	{ "SaveStateCouldNotWrite", u8"Could not write save state: %1" },
 	{ "SaveStateEmpty", u8"Slot is empty." },
 	{ "SaveStateIncompatibleVersion", u8"Save state is incompatible with this version of Mesen." },
 	{ "SaveStateInvalidFile", u8"Invalid save state file." },
@@ -32,7 +32,7 @@ MesenMovie::~MesenMovie()
 void MesenMovie::Stop()
 {
 	if(_playing) {
-		bool isEndOfMovie = _lastPollCounter >= _inputData.size();
+		bool isEndOfMovie = _lastPollCounter >= _frameOffsets.size();
 
 		if(!_forTest) {
 			MessageManager::DisplayMessage("Movies", isEndOfMovie ? "MovieEnded" : "MovieStopped");
@@ -61,12 +61,34 @@ bool MesenMovie::SetInput(BaseControlDevice *device)
 	uint32_t inputRowIndex = _controlManager->GetPollCounter();
 	_lastPollCounter = inputRowIndex;
 
-	if(_inputData.size() > inputRowIndex && _inputData[inputRowIndex].size() > _deviceIndex) {
-		device->SetTextState(_inputData[inputRowIndex][_deviceIndex]);
+	if(_frameOffsets.size() > inputRowIndex) {
+		const char* row = (const char*)_inputLog.data() + _frameOffsets[inputRowIndex];
+		const char* rowEnd = (const char*)_inputLog.data() + _inputLog.size();
+		const char* lineEnd = (const char*)memchr(row, '\n', rowEnd - row);
+		if(lineEnd) {
+			rowEnd = lineEnd;
+		}
+
+		//Find the current device's field in the line (fields are separated by |)
+		const char* field = row;
+		for(size_t i = 0; i < _deviceIndex && field; i++) {
+			field = (const char*)memchr(field, '|', rowEnd - field);
+			if(field) {
+				field++;
+			}
+		}
 
-		_deviceIndex++;
-		if(_deviceIndex >= _inputData[inputRowIndex].size()) {
-			//Move to the next frame's data
+		if(field) {
+			const char* fieldEnd = (const char*)memchr(field, '|', rowEnd - field);
+			device->SetTextState(string(field, fieldEnd ? fieldEnd : rowEnd));
+
+			_deviceIndex++;
+			if(!fieldEnd) {
+				//Move to the next frame's data
+				_deviceIndex = 0;
+			}
+		} else {
+			//Should not happen, _deviceIndex is reset after the line's last field
 			_deviceIndex = 0;
 		}
 	} else {
@@ -109,22 +131,24 @@ bool MesenMovie::Play(VirtualFile &file)
 	_reader.reset(new ZipReader());
 	_reader->LoadArchive(ss);
 
-	stringstream settingsData, inputData;
+	stringstream settingsData;
 	if(!_reader->GetStream("GameSettings.txt", settingsData)) {
 		MessageManager::Log("[Movie] File not found: GameSettings.txt");
 		return false;
 	}
-	if(!_reader->GetStream("Input.txt", inputData)) {
+	if(!_reader->ExtractFile("Input.txt", _inputLog)) {
 		MessageManager::Log("[Movie] File not found: Input.txt");
 		return false;
 	}
 
-	while(inputData) {
-		string line;
-		std::getline(inputData, line);
-		if(line.substr(0, 1) == "|") {
-			_inputData.push_back(StringUtilities::Split(line.substr(1), '|'));
+	//Index the start of each frame's input (lines that start with |)
+	size_t logSize = _inputLog.size();
+	for(size_t i = 0; i < logSize;) {
+		if(_inputLog[i] == '|') {
+			_frameOffsets.push_back((uint32_t)i + 1);
 		}
+		uint8_t* lineEnd = (uint8_t*)memchr(_inputLog.data() + i, '\n', logSize - i);
+		i = lineEnd ? (lineEnd - _inputLog.data() + 1) : logSize;
 	}
 
 	_deviceIndex = 0;
@@ -23,7 +23,11 @@ private:
 	bool _playing = false;
 	size_t _deviceIndex = 0;
 	uint32_t _lastPollCounter = 0;
-	vector<vector<string>> _inputData;
+
+	//Content of Input.txt, and the offset of each frame's input line in it
+	//Each line is only split into separate fields when it's used by SetInput
+	vector<uint8_t> _inputLog;
+	vector<uint32_t> _frameOffsets;
 	vector<string> _cheats;
 	vector<CheatCode> _originalCheats;
 	stringstream _emuSettingsBackup;
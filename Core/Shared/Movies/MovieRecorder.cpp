@@ -216,12 +216,13 @@ bool MovieRecorder::CreateMovie(string movieFile, deque<RewindData> &data, uint3
 		_inputData = stringstream();
 
 		for(uint32_t i = startPosition; i < endPosition; i++) {
-			RewindData rewindData = data[i];
+			RewindData& rewindData = data[i];
 			for(uint32_t j = 0; j < RewindManager::BufferSize; j++) {
 				for(shared_ptr<BaseControlDevice> &device : devices) {
 					uint8_t port = device->GetPort();
-					if(j < rewindData.InputLogs[port].size()) {
-						device->SetRawState(rewindData.InputLogs[port][j]);
+					if(j < rewindData.InputLogs[port].GetCount()) {
+						RewindInputState state = rewindData.InputLogs[port].Get(j);
+						device->SetRawState(state.Data, state.Size);
 						_inputData << ("|" + device->GetTextState());
 					}
 				}
@@ -0,0 +1,104 @@
+#include "pch.h"
+#include "Shared/PerformanceCounters.h"
+#include "Utilities/FolderUtilities.h"
+#include "Utilities/StringUtilities.h"
+#include "Utilities/magic_enum.hpp"
+
+PerformanceCounters::PerformanceCounters()
+{
+	_history.resize(PerformanceCounters::HistorySize);
+}
+
+void PerformanceCounters::EndFrame(uint32_t frameNumber)
+{
+	PerfCounterFrame frame = {};
+	frame.FrameNumber = frameNumber;
+	for(int i = 0; i < (int)PerfCounter::Count; i++) {
+		uint64_t time = _counters[i].Time.load(std::memory_order_relaxed);
+		uint32_t calls = _counters[i].Calls.load(std::memory_order_relaxed);
+		frame.Time[i] = (time - _prevTime[i]) / 1000000.0;
+		frame.Calls[i] = calls - _prevCalls[i];
+		_prevTime[i] = time;
+		_prevCalls[i] = calls;
+	}
+
+	auto lock = _historyLock.AcquireSafe();
+	_history[_historyPos] = frame;
+	_historyPos = (_historyPos + 1) % PerformanceCounters::HistorySize;
+	_historyCount = std::min(_historyCount + 1, PerformanceCounters::HistorySize);
+}
+
+void PerformanceCounters::Reset()
+{
+	for(int i = 0; i < (int)PerfCounter::Count; i++) {
+		_prevTime[i] = _counters[i].Time.load(std::memory_order_relaxed);
+		_prevCalls[i] = _counters[i].Calls.load(std::memory_order_relaxed);
+	}
+
+	auto lock = _historyLock.AcquireSafe();
+	_historyPos = 0;
+	_historyCount = 0;
+}
+
+uint32_t PerformanceCounters::GetHistory(PerfCounterFrame* frames, uint32_t maxCount)
+{
+	auto lock = _historyLock.AcquireSafe();
+	uint32_t count = std::min(maxCount, _historyCount);
+	uint32_t start = (_historyPos + PerformanceCounters::HistorySize - count) % PerformanceCounters::HistorySize;
+	for(uint32_t i = 0; i < count; i++) {
+		frames[i] = _history[(start + i) % PerformanceCounters::HistorySize];
+	}
+	return count;
+}
+
+bool PerformanceCounters::SaveHistory(string filename)
+{
+	vector<PerfCounterFrame> frames(PerformanceCounters::HistorySize);
+	frames.resize(GetHistory(frames.data(), (uint32_t)frames.size()));
+
+	ofstream out(filename, std::ios::out | std::ios::binary);
+	if(!out) {
+		return false;
+	}
+
+	if(StringUtilities::ToLower(FolderUtilities::GetExtension(filename)) == ".json") {
+		WriteJson(out, frames);
+	} else {
+		WriteCsv(out, frames);
+	}
+	return out.good();
+}
+
+void PerformanceCounters::WriteCsv(ofstream& out, vector<PerfCounterFrame>& frames)
+{
+	out << "Frame";
+	for(int i = 0; i < (int)PerfCounter::Count; i++) {
+		string name = string(magic_enum::enum_name((PerfCounter)i));
+		out << "," << name << "Time," << name << "Calls";
+	}
+	out << "\n";
+
+	out << std::fixed << std::setprecision(4);
+	for(PerfCounterFrame& frame : frames) {
+		out << frame.FrameNumber;
+		for(int i = 0; i < (int)PerfCounter::Count; i++) {
+			out << "," << frame.Time[i] << "," << frame.Calls[i];
+		}
+		out << "\n";
+	}
+}
+
+void PerformanceCounters::WriteJson(ofstream& out, vector<PerfCounterFrame>& frames)
+{
+	out << std::fixed << std::setprecision(4);
+	out << "[\n";
+	for(size_t j = 0; j < frames.size(); j++) {
+		PerfCounterFrame& frame = frames[j];
+		out << "  { \"frame\": " << frame.FrameNumber;
+		for(int i = 0; i < (int)PerfCounter::Count; i++) {
+			out << ", \"" << magic_enum::enum_name((PerfCounter)i) << "\": { \"time\": " << frame.Time[i] << ", \"calls\": " << frame.Calls[i] << " }";
+		}
+		out << (j + 1 < frames.size() ? " },\n" : " }\n");
+	}
+	out << "]\n";
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include "pch.h"
+#include <chrono>
+#include "Utilities/SimpleLock.h"
+
+enum class PerfCounter
+{
+	Emulation,
+	AudioMixing,
+	VideoDecode,
+	VideoFilter,
+	Present,
+	Rewind,
+	Netplay,
+	Script,
+	Count
+};
+
+//Time spent in each subsystem since the end of the previous frame
+//Counters updated by other threads (decode, render, netplay) are added to the frame during which they complete
+struct PerfCounterFrame
+{
+	double Time[(int)PerfCounter::Count]; //in ms
+	uint32_t Calls[(int)PerfCounter::Count];
+	uint32_t FrameNumber;
+};
+
+class PerformanceCounters
+{
+private:
+	static constexpr uint32_t HistorySize = 600;
+
+	//Each counter is normally only updated by a single thread, keep them on separate cache lines to avoid contention between threads
+	struct alignas(64) Counter
+	{
+		atomic<uint64_t> Time; //in ns
+		atomic<uint32_t> Calls;
+	};
+
+	Counter _counters[(int)PerfCounter::Count] = {};
+	uint64_t _prevTime[(int)PerfCounter::Count] = {};
+	uint32_t _prevCalls[(int)PerfCounter::Count] = {};
+
+	SimpleLock _historyLock;
+	vector<PerfCounterFrame> _history;
+	uint32_t _historyPos = 0;
+	uint32_t _historyCount = 0;
+
+	void WriteCsv(ofstream& out, vector<PerfCounterFrame>& frames);
+	void WriteJson(ofstream& out, vector<PerfCounterFrame>& frames);
+
+public:
+	PerformanceCounters();
+
+	__forceinline void AddTime(PerfCounter counter, uint64_t ns)
+	{
+		Counter& c = _counters[(int)counter];
+		c.Time.fetch_add(ns, std::memory_order_relaxed);
+		c.Calls.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	//Called by the emulation thread at the end of each frame
+	void EndFrame(uint32_t frameNumber);
+	void Reset();
+
+	//Returns the most recent frames, oldest first
+	uint32_t GetHistory(PerfCounterFrame* frames, uint32_t maxCount);
+
+	//Writes the history to a .csv file (or a .json file, based on the file's extension)
+	bool SaveHistory(string filename);
+};
+
+//Adds the time elapsed between its construction and destruction to a counter
+class PerfTimer
+{
+private:
+	PerformanceCounters* _counters;
+	PerfCounter _counter;
+	std::chrono::steady_clock::time_point _start;
+
+public:
+	PerfTimer(PerformanceCounters* counters, PerfCounter counter)
+	{
+		_counters = counters;
+		_counter = counter;
+		_start = std::chrono::steady_clock::now();
+	}
+
+	~PerfTimer()
+	{
+		std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - _start;
+		_counters->AddTime(_counter, (uint64_t)elapsed.count());
+	}
+};
@@ -94,3 +94,85 @@ void RewindData::SaveState(Emulator* emu, deque<RewindData>& prevStates, int32_t
 	CompressionHelper::Compress(data, 1, _saveStateData);
 	FrameCount = 0;
 }
+
+void RewindInputLog::SetStride(uint32_t stride)
+{
+	//Only needed when a state larger than the previous ones is recorded (e.g when the controller type changes)
+	vector<uint8_t> data;
+	data.reserve(stride * std::max(GetCount() + 1, RewindInputLog::InitialCapacity));
+	data.resize(GetCount() * stride);
+	for(uint32_t i = _start; i < _end; i++) {
+		memcpy(data.data() + (i - _start) * stride, _data.data() + i * _stride, _stride);
+	}
+
+	_data.swap(data);
+	_end -= _start;
+	_start = 0;
+	_stride = stride;
+}
+
+void RewindInputLog::PushBack(const uint8_t* state, uint32_t size)
+{
+	bool isLarge = size > RewindInputLog::MaxInlineStateSize;
+	uint32_t stride = 1 + (isLarge ? sizeof(uint32_t) : size);
+	if(stride > _stride) {
+		SetStride(stride);
+	} else if(_data.capacity() == 0) {
+		_data.reserve(_stride * RewindInputLog::InitialCapacity);
+	}
+
+	size_t offset = (size_t)_end * _stride;
+	_data.resize(offset + _stride);
+	uint8_t* entry = _data.data() + offset;
+	if(isLarge) {
+		uint32_t index = (uint32_t)_largeStates.size();
+		entry[0] = RewindInputLog::LargeStateMarker;
+		memcpy(entry + 1, &index, sizeof(index));
+		_largeStates.emplace_back(state, state + size);
+	} else {
+		entry[0] = (uint8_t)size;
+		memcpy(entry + 1, state, size);
+	}
+	_end++;
+}
+
+void RewindInputLog::PopFront()
+{
+	if(_start < _end) {
+		_start++;
+		if(_start == _end) {
+			//Keep the buffer's capacity, it will be reused by the next states
+			_start = _end = 0;
+			_data.clear();
+			_largeStates.clear();
+		}
+	}
+}
+
+void RewindInputLog::PopBack()
+{
+	if(_start < _end) {
+		_end--;
+		if(_data[(size_t)_end * _stride] == RewindInputLog::LargeStateMarker) {
+			_largeStates.pop_back();
+		}
+		_data.resize((size_t)_end * _stride);
+		if(_start == _end) {
+			_start = _end = 0;
+			_data.clear();
+			_largeStates.clear();
+		}
+	}
+}
+
+RewindInputState RewindInputLog::Get(uint32_t index) const
+{
+	const uint8_t* entry = _data.data() + (size_t)(_start + index) * _stride;
+	if(entry[0] == RewindInputLog::LargeStateMarker) {
+		uint32_t largeIndex;
+		memcpy(&largeIndex, entry + 1, sizeof(largeIndex));
+		const vector<uint8_t>& state = _largeStates[largeIndex];
+		return { state.data(), (uint32_t)state.size() };
+	}
+	return { entry + 1, entry[0] };
+}
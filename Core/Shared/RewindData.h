@@ -5,6 +5,43 @@
 
 class Emulator;
 
+struct RewindInputState
+{
+	const uint8_t* Data;
+	uint32_t Size;
+};
+
+//Stores the input states recorded for a single port during a rewind block in a single buffer.
+//Each entry is _stride bytes long: 1 byte for the state's size followed by the state's data.
+//States that are too large to be stored inline (e.g barcodes) are kept in a separate list.
+class RewindInputLog
+{
+private:
+	static constexpr uint32_t MaxInlineStateSize = 32;
+	static constexpr uint8_t LargeStateMarker = 0xFF;
+	static constexpr uint32_t InitialCapacity = 32; //Rewind blocks contain 30 frames
+
+	vector<uint8_t> _data;
+	vector<vector<uint8_t>> _largeStates;
+	uint32_t _stride = 0;
+	uint32_t _start = 0;
+	uint32_t _end = 0;
+
+	void SetStride(uint32_t stride);
+
+public:
+	uint32_t GetCount() const { return _end - _start; }
+	bool IsEmpty() const { return _end == _start; }
+
+	void PushBack(const uint8_t* state, uint32_t size);
+	void PopFront();
+	void PopBack();
+
+	//The returned pointer is only valid until the log is modified
+	RewindInputState Get(uint32_t index) const;
+	RewindInputState GetFront() const { return Get(0); }
+};
+
 class RewindData
 {
 private:
@@ -15,7 +52,7 @@ private:
 	void ProcessXorState(T& data, deque<RewindData>& prevStates, int32_t position);
 
 public:
-	std::deque<ControlDeviceState> InputLogs[BaseControlDevice::PortCount];
+	RewindInputLog InputLogs[BaseControlDevice::PortCount];
 	int32_t FrameCount = 0;
 	bool EndOfSegment = false;
 	bool IsFullState = false;
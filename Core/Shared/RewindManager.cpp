@@ -3,6 +3,7 @@
 #include "Shared/MessageManager.h"
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
+#include "Shared/PerformanceCounters.h"
 #include "Shared/Video/VideoRenderer.h"
 #include "Shared/Audio/SoundMixer.h"
 #include "Shared/BaseControlDevice.h"
@@ -75,10 +76,10 @@ void RewindManager::ProcessNotification(ConsoleNotificationType type, void * par
 					_currentHistory.FrameCount++;
 					if(_framesToFastForward == 0) {
 						for(int i = 0; i < 4; i++) {
-							size_t numberToRemove = _currentHistory.InputLogs[i].size();
+							uint32_t numberToRemove = _currentHistory.InputLogs[i].GetCount();
 							_currentHistory.InputLogs[i] = _historyBackup.front().InputLogs[i];
-							for(size_t j = 0; j < numberToRemove; j++) {
-								_currentHistory.InputLogs[i].pop_back();
+							for(uint32_t j = 0; j < numberToRemove; j++) {
+								_currentHistory.InputLogs[i].PopBack();
 							}
 						}
 						_historyBackup.clear();
@@ -213,10 +214,8 @@ void RewindManager::ForceStop(bool deleteFutureData)
 				_currentHistory = _historyBackup.front();
 				_currentHistory.FrameCount -= framesToRemove;
 				for(int i = 0; i < BaseControlDevice::PortCount; i++) {
-					for(int j = 0; j < orgHistory.InputLogs[i].size(); j++) {
-						if(!_currentHistory.InputLogs[i].empty()) {
-							_currentHistory.InputLogs[i].pop_back();
-						}
+					for(uint32_t j = 0; j < orgHistory.InputLogs[i].GetCount(); j++) {
+						_currentHistory.InputLogs[i].PopBack();
 					}
 				}
 			}
@@ -308,6 +307,7 @@ void RewindManager::ProcessEndOfFrame()
 			}
 		}
 	} else if(_currentHistory.FrameCount >= RewindManager::BufferSize) {
+		PerfTimer perfTimer(_emu->GetPerformanceCounters(), PerfCounter::Rewind);
 		AddHistoryBlock();
 	}
 }
@@ -394,7 +394,8 @@ void RewindManager::RecordInput(vector<shared_ptr<BaseControlDevice>> devices)
 {
 	if(_settings->GetPreferences().RewindBufferSize > 0 && _rewindState == RewindState::Stopped) {
 		for(shared_ptr<BaseControlDevice> &device : devices) {
-			_currentHistory.InputLogs[device->GetPort()].push_back(device->GetRawState());
+			device->GetRawState(_recordedState);
+			_currentHistory.InputLogs[device->GetPort()].PushBack(_recordedState.State.data(), (uint32_t)_recordedState.State.size());
 		}
 	}
 }
@@ -402,10 +403,10 @@ void RewindManager::RecordInput(vector<shared_ptr<BaseControlDevice>> devices)
 bool RewindManager::SetInput(BaseControlDevice *device)
 {
 	uint8_t port = device->GetPort();
-	if(!_currentHistory.InputLogs[port].empty() && IsRewinding()) {
-		ControlDeviceState state = _currentHistory.InputLogs[port].front();
-		_currentHistory.InputLogs[port].pop_front();
-		device->SetRawState(state);
+	if(!_currentHistory.InputLogs[port].IsEmpty() && IsRewinding()) {
+		RewindInputState state = _currentHistory.InputLogs[port].GetFront();
+		device->SetRawState(state.Data, state.Size);
+		_currentHistory.InputLogs[port].PopFront();
 		return true;
 	} else {
 		return false;
@@ -50,6 +50,7 @@ private:
 	deque<RewindData> _history;
 	deque<RewindData> _historyBackup;
 	RewindData _currentHistory = {};
+	ControlDeviceState _recordedState = {};
 
 	RewindState _rewindState = RewindState::Stopped;
 	int32_t _framesToFastForward = 0;
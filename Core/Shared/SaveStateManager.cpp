@@ -3,6 +3,7 @@
 #include "Utilities/ZipWriter.h"
 #include "Utilities/ZipReader.h"
 #include "Utilities/PNGHelper.h"
+#include "Utilities/Serializer.h"
 #include "Shared/SaveStateManager.h"
 #include "Shared/MessageManager.h"
 #include "Shared/Emulator.h"
@@ -10,6 +11,7 @@
 #include "Shared/Movies/MovieManager.h"
 #include "Shared/RenderedFrame.h"
 #include "Shared/EventType.h"
+#include "Shared/NotificationManager.h"
 #include "Debugger/Debugger.h"
 #include "Netplay/GameClient.h"
 #include "Shared/Video/VideoDecoder.h"
@@ -22,6 +24,18 @@ SaveStateManager::SaveStateManager(Emulator* emu)
 	_lastIndex = 1;
 }
 
+SaveStateManager::~SaveStateManager()
+{
+	if(_saveThread) {
+		{
+			std::unique_lock<std::mutex> lock(_saveLock);
+			_stopSaveThread = true;
+		}
+		_saveSignal.notify_all();
+		_saveThread->join();
+	}
+}
+
 string SaveStateManager::GetStateFilepath(int stateIndex)
 {
 	string romFile = _emu->GetRomInfo().RomFile.GetFileName();
@@ -58,7 +72,28 @@ bool SaveStateManager::LoadState()
 	return LoadState(_lastIndex);
 }
 
-void SaveStateManager::GetSaveStateHeader(ostream &stream)
+void SaveStateManager::TakeSnapshot(SaveStateSnapshot& snapshot, bool includeState)
+{
+	snapshot.Console = _emu->GetConsoleType();
+
+	PpuFrameInfo frame = _emu->GetPpuFrame();
+	snapshot.FrameBuffer.assign(frame.FrameBuffer, frame.FrameBuffer + frame.FrameBufferSize);
+	snapshot.FrameWidth = frame.Width;
+	snapshot.FrameHeight = frame.Height;
+	snapshot.FrameScale = (uint32_t)(_emu->GetVideoDecoder()->GetLastFrameScale() * 100);
+
+	RomInfo romInfo = _emu->GetRomInfo();
+	snapshot.RomName = FolderUtilities::GetFilename(romInfo.RomFile.GetFileName(), true);
+
+	if(includeState) {
+		//The state is compressed later, in WriteSaveStateFile
+		std::stringstream state;
+		_emu->Serialize(state, false, 0);
+		snapshot.StateData = state.str();
+	}
+}
+
+void SaveStateManager::WriteHeader(ostream& stream, SaveStateSnapshot& snapshot)
 {
 	uint32_t emuVersion = _emu->GetSettings()->GetVersion();
 	uint32_t formatVersion = SaveStateManager::FileFormatVersion;
@@ -66,14 +101,19 @@ void SaveStateManager::GetSaveStateHeader(ostream &stream)
 	WriteValue(stream, emuVersion);
 	WriteValue(stream, formatVersion);
 
-	WriteValue(stream, (uint32_t)_emu->GetConsoleType());
+	WriteValue(stream, (uint32_t)snapshot.Console);
 
-	SaveVideoData(stream);
+	SaveVideoData(stream, snapshot);
 
-	RomInfo romInfo = _emu->GetRomInfo();
-	string romName = FolderUtilities::GetFilename(romInfo.RomFile.GetFileName(), true);
-	WriteValue(stream, (uint32_t)romName.size());
-	stream.write(romName.c_str(), romName.size());
+	WriteValue(stream, (uint32_t)snapshot.RomName.size());
+	stream.write(snapshot.RomName.c_str(), snapshot.RomName.size());
+}
+
+void SaveStateManager::GetSaveStateHeader(ostream &stream)
+{
+	SaveStateSnapshot snapshot;
+	TakeSnapshot(snapshot, false);
+	WriteHeader(stream, snapshot);
 }
 
 void SaveStateManager::SaveState(ostream &stream)
@@ -84,45 +124,126 @@ void SaveStateManager::SaveState(ostream &stream)
 
 bool SaveStateManager::SaveState(string filepath, bool showSuccessMessage)
 {
-	ofstream file(filepath, ios::out | ios::binary);
+	//The file is written on the save thread, make sure the destination is writable before queuing the save
+	//A separate file is used for the check, to avoid interfering with a queued save to the same file
+	string probeFilepath = filepath + ".probe";
+	bool canWrite = (bool)ofstream(probeFilepath, ios::out | ios::app | ios::binary);
+	std::remove(probeFilepath.c_str());
+	if(!canWrite) {
+		MessageManager::DisplayMessage("SaveStates", "SaveStateCouldNotWrite", filepath);
+		return false;
+	}
+
+	QueueSaveState(filepath, -1, showSuccessMessage);
+	return true;
+}
+
+void SaveStateManager::SaveState(int stateIndex, bool displayMessage)
+{
+	QueueSaveState(GetStateFilepath(stateIndex), stateIndex, displayMessage);
+}
+
+void SaveStateManager::QueueSaveState(string filepath, int stateIndex, bool showMessage)
+{
+	unique_ptr<SaveStateSnapshot> snapshot(new SaveStateSnapshot());
+	snapshot->Filepath = filepath;
+	snapshot->StateIndex = stateIndex;
+	snapshot->ShowMessage = showMessage;
+
+	{
+		//Only copy the state while the emulation is paused - compression and file I/O are done on the save thread
+		auto lock = _emu->AcquireLock();
+		TakeSnapshot(*snapshot, true);
+		_emu->ProcessEvent(EventType::StateSaved);
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(_saveLock);
+		_pendingSaves.push_back(std::move(snapshot));
+		if(!_saveThread) {
+			_saveThread.reset(new thread(&SaveStateManager::ProcessPendingSaves, this));
+		}
+	}
+	_saveSignal.notify_all();
+}
 
-	if(file) {
+void SaveStateManager::ProcessPendingSaves()
+{
+	while(true) {
+		unique_ptr<SaveStateSnapshot> snapshot;
 		{
-			auto lock = _emu->AcquireLock();
-			SaveState(file);
-			_emu->ProcessEvent(EventType::StateSaved);
+			std::unique_lock<std::mutex> lock(_saveLock);
+			_saveSignal.wait(lock, [&] { return _stopSaveThread || !_pendingSaves.empty(); });
+			if(_pendingSaves.empty()) {
+				//Stop was requested and all queued states have been written
+				return;
+			}
+			snapshot = std::move(_pendingSaves.front());
+			_pendingSaves.pop_front();
+			_saveInProgress = true;
 		}
-		file.close();
 
-		if(showSuccessMessage) {
-			MessageManager::DisplayMessage("SaveStates", "SaveStateSavedFile", filepath);
+		if(WriteSaveStateFile(*snapshot)) {
+			if(snapshot->ShowMessage) {
+				if(snapshot->StateIndex >= 0) {
+					MessageManager::DisplayMessage("SaveStates", "SaveStateSaved", std::to_string(snapshot->StateIndex));
+				} else {
+					MessageManager::DisplayMessage("SaveStates", "SaveStateSavedFile", snapshot->Filepath);
+				}
+			}
+			_emu->GetNotificationManager()->SendNotification(ConsoleNotificationType::StateSaved);
+		} else {
+			MessageManager::DisplayMessage("SaveStates", "SaveStateCouldNotWrite", snapshot->Filepath);
 		}
-		return true;
+
+		{
+			std::unique_lock<std::mutex> lock(_saveLock);
+			_saveInProgress = false;
+		}
+		_saveSignal.notify_all();
 	}
-	return false;
 }
 
-void SaveStateManager::SaveState(int stateIndex, bool displayMessage)
+bool SaveStateManager::WriteSaveStateFile(SaveStateSnapshot& snapshot)
 {
-	string filepath = SaveStateManager::GetStateFilepath(stateIndex);
-	if(SaveState(filepath, false)) {
-		if(displayMessage) {
-			MessageManager::DisplayMessage("SaveStates", "SaveStateSaved", std::to_string(stateIndex));
-		}
+	//Write to a temporary file first, to avoid leaving a truncated save state behind if the write fails
+	string tmpFilepath = snapshot.Filepath + ".tmp";
+	ofstream file(tmpFilepath, ios::out | ios::binary);
+	if(!file) {
+		return false;
 	}
+
+	WriteHeader(file, snapshot);
+
+	//Serialize() wrote a "not compressed" flag followed by the raw state data, compress it now
+	uint8_t* stateData = (uint8_t*)snapshot.StateData.data() + 1;
+	Serializer::SaveTo(file, stateData, (uint32_t)snapshot.StateData.size() - 1, 1);
+
+	file.close();
+	if(!file) {
+		std::remove(tmpFilepath.c_str());
+		return false;
+	}
+	return FolderUtilities::RenameFile(tmpFilepath, snapshot.Filepath);
 }
 
-void SaveStateManager::SaveVideoData(ostream& stream)
+void SaveStateManager::WaitForPendingSaves()
 {
-	PpuFrameInfo frame = _emu->GetPpuFrame();
-	WriteValue(stream, frame.FrameBufferSize);
-	WriteValue(stream, frame.Width);
-	WriteValue(stream, frame.Height);
-	WriteValue(stream, (uint32_t)(_emu->GetVideoDecoder()->GetLastFrameScale() * 100));
+	std::unique_lock<std::mutex> lock(_saveLock);
+	_saveSignal.wait(lock, [&] { return _pendingSaves.empty() && !_saveInProgress; });
+}
 
-	unsigned long compressedSize = compressBound(frame.FrameBufferSize);
+void SaveStateManager::SaveVideoData(ostream& stream, SaveStateSnapshot& snapshot)
+{
+	uint32_t frameBufferSize = (uint32_t)snapshot.FrameBuffer.size();
+	WriteValue(stream, frameBufferSize);
+	WriteValue(stream, snapshot.FrameWidth);
+	WriteValue(stream, snapshot.FrameHeight);
+	WriteValue(stream, snapshot.FrameScale);
+
+	unsigned long compressedSize = compressBound(frameBufferSize);
 	vector<uint8_t> compressedData(compressedSize, 0);
-	compress2(compressedData.data(), &compressedSize, (const unsigned char*)frame.FrameBuffer, frame.FrameBufferSize, MZ_DEFAULT_LEVEL);
+	compress2(compressedData.data(), &compressedSize, (const unsigned char*)snapshot.FrameBuffer.data(), frameBufferSize, MZ_DEFAULT_LEVEL);
 
 	WriteValue(stream, (uint32_t)compressedSize);
 	stream.write((char*)compressedData.data(), (uint32_t)compressedSize);
@@ -220,6 +341,9 @@ bool SaveStateManager::LoadState(istream &stream)
 
 bool SaveStateManager::LoadState(string filepath, bool showSuccessMessage)
 {
+	//Make sure the file isn't being written to (e.g quick save immediately followed by a quick load)
+	WaitForPendingSaves();
+
 	ifstream file(filepath, ios::in | ios::binary);
 	bool result = false;
 
@@ -316,6 +440,8 @@ void SaveStateManager::LoadRecentGame(string filename, bool resetGame)
 
 int32_t SaveStateManager::GetSaveStatePreview(string saveStatePath, uint8_t* pngData)
 {
+	WaitForPendingSaves();
+
 	ifstream stream(saveStatePath, ios::binary);
 
 	if(!stream) {
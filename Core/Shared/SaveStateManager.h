@@ -1,8 +1,27 @@
 #pragma once
 #include "pch.h"
+#include <mutex>
+#include <condition_variable>
 
 class Emulator;
 struct RenderedFrame;
+enum class ConsoleType;
+
+//Everything needed to write a save state file, copied while the emulation is paused
+struct SaveStateSnapshot
+{
+	ConsoleType Console = {};
+	vector<uint8_t> FrameBuffer;
+	uint32_t FrameWidth = 0;
+	uint32_t FrameHeight = 0;
+	uint32_t FrameScale = 0;
+	string RomName;
+	string StateData;
+
+	string Filepath;
+	int StateIndex = -1;
+	bool ShowMessage = false;
+};
 
 class SaveStateManager
 {
@@ -12,8 +31,22 @@ private:
 	atomic<uint32_t> _lastIndex;
 	Emulator* _emu;
 
+	//Compression and file writes are done on a separate thread to avoid pausing the emulation
+	unique_ptr<thread> _saveThread;
+	std::mutex _saveLock;
+	std::condition_variable _saveSignal;
+	deque<unique_ptr<SaveStateSnapshot>> _pendingSaves;
+	bool _saveInProgress = false;
+	bool _stopSaveThread = false;
+
 	string GetStateFilepath(int stateIndex);
-	void SaveVideoData(ostream& stream);
+	void TakeSnapshot(SaveStateSnapshot& snapshot, bool includeState);
+	void WriteHeader(ostream& stream, SaveStateSnapshot& snapshot);
+	void SaveVideoData(ostream& stream, SaveStateSnapshot& snapshot);
+
+	void QueueSaveState(string filepath, int stateIndex, bool showMessage);
+	void ProcessPendingSaves();
+	bool WriteSaveStateFile(SaveStateSnapshot& snapshot);
 	bool GetVideoData(vector<uint8_t>& out, RenderedFrame& frame, istream& stream);
 
 	void WriteValue(ostream& stream, uint32_t value);
@@ -25,6 +58,7 @@ public:
 	static constexpr uint32_t AutoSaveStateIndex = 11;
 
 	SaveStateManager(Emulator* emu);
+	~SaveStateManager();
 
 	void SaveState();
 	bool LoadState();
@@ -38,6 +72,9 @@ public:
 	bool LoadState(string filepath, bool showSuccessMessage = true);
 	bool LoadState(int stateIndex);
 
+	//Blocks until all queued save states have been written to the disk
+	void WaitForPendingSaves();
+
 	void SaveRecentGame(string romName, string romPath, string patchPath);
 	void LoadRecentGame(string filename, bool resetGame);
 
@@ -370,6 +370,7 @@ struct EmulationConfig
 	uint32_t RewindSpeed = 100;
 
 	uint32_t RunAheadFrames = 0;
+	bool LateInputLatching = false;
 };
 
 struct OverscanDimensions
@@ -26,9 +26,13 @@ ShortcutKeyHandler::ShortcutKeyHandler(Emulator* emu)
 
 	_stopThread = false;
 	_thread = std::thread([=]() {
+		uint32_t inputChangeCounter = 0;
 		while(!_stopThread) {
 			ProcessKeys();
-			std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(50));
+
+			//Key managers that report input changes only need to be polled to handle the run single frame repeat delay
+			uint32_t timeout = (_needRepeat || KeyManager::IsPollingRequired()) ? 50 : 1000;
+			inputChangeCounter = KeyManager::WaitForInputChange(inputChangeCounter, timeout);
 		}
 	});
 }
@@ -36,6 +40,7 @@ ShortcutKeyHandler::ShortcutKeyHandler(Emulator* emu)
 ShortcutKeyHandler::~ShortcutKeyHandler()
 {
 	_stopThread = true;
+	KeyManager::NotifyInputChanged();
 	_thread.join();
 }
 
@@ -115,7 +120,10 @@ bool ShortcutKeyHandler::DetectKeyRelease(EmulatorShortcut shortcut)
 void ShortcutKeyHandler::ProcessRunSingleFrame()
 {
 	_runSingleFrameRepeatTimer.Reset();
-	_needRepeat = true;
+	if(!_needRepeat.exchange(true)) {
+		//Wake up the shortcut thread to start checking the repeat delay
+		KeyManager::NotifyInputChanged();
+	}
 	_emu->PauseOnNextFrame();
 }
 
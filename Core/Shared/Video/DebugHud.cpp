@@ -23,7 +23,7 @@ void DebugHud::ClearScreen()
 {
 	auto lock = _commandLock.AcquireSafe();
 	_commands.clear();
-	_drawPixels.clear();
+	std::fill(_prevDrawBuffer.begin(), _prevDrawBuffer.end(), 0);
 }
 
 bool DebugHud::Draw(uint32_t* argbBuffer, FrameInfo frameInfo, OverscanDimensions overscan, uint32_t frameNumber, HudScaleFactors scaleFactors, bool clearAndUpdate)
@@ -32,39 +32,28 @@ bool DebugHud::Draw(uint32_t* argbBuffer, FrameInfo frameInfo, OverscanDimension
 
 	bool isDirty = false;
 	if(clearAndUpdate) {
-		unordered_map<uint32_t, uint32_t> drawPixels;
-		drawPixels.reserve(1000);
-		for(unique_ptr<DrawCommand>& command : _commands) {
-			command->Draw(&drawPixels, argbBuffer, frameInfo, overscan, frameNumber, scaleFactors);
+		//Draw everything in a separate buffer and only update the output if the result differs from the previous frame
+		size_t pixelCount = (size_t)frameInfo.Height * frameInfo.Width;
+		if(_drawBuffer.size() != pixelCount) {
+			_drawBuffer.resize(pixelCount);
+			_prevDrawBuffer.assign(pixelCount, 0);
+			isDirty = true;
 		}
 
-		isDirty = drawPixels.size() != _drawPixels.size();
-		if(!isDirty) {
-			for(auto keyValue : drawPixels) {
-				auto match = _drawPixels.find(keyValue.first);
-				if(match != _drawPixels.end()) {
-					if(keyValue.second != match->second) {
-						isDirty = true;
-						break;
-					}
-				} else {
-					isDirty = true;
-					break;
-				}
-			}
+		std::fill(_drawBuffer.begin(), _drawBuffer.end(), 0);
+		for(unique_ptr<DrawCommand>& command : _commands) {
+			command->Draw(_drawBuffer.data(), frameInfo, overscan, frameNumber, scaleFactors);
 		}
 
+		isDirty |= memcmp(_drawBuffer.data(), _prevDrawBuffer.data(), pixelCount * sizeof(uint32_t)) != 0;
 		if(isDirty) {
-			memset(argbBuffer, 0, frameInfo.Height * frameInfo.Width * sizeof(uint32_t));
-			for(auto keyValue : drawPixels) {
-				argbBuffer[keyValue.first] = keyValue.second;
-			}
-			_drawPixels = drawPixels;
+			memcpy(argbBuffer, _drawBuffer.data(), pixelCount * sizeof(uint32_t));
+			_drawBuffer.swap(_prevDrawBuffer);
 		}
 	} else {
 		isDirty = true;
 		for(unique_ptr<DrawCommand>& command : _commands) {
-			command->Draw(nullptr, argbBuffer, frameInfo, overscan, frameNumber, scaleFactors);
+			command->Draw(argbBuffer, frameInfo, overscan, frameNumber, scaleFactors);
 		}
 	}
 
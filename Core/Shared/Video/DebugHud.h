@@ -11,7 +11,8 @@ private:
 	vector<unique_ptr<DrawCommand>> _commands;
 	atomic<uint32_t> _commandCount;
 	SimpleLock _commandLock;
-	unordered_map<uint32_t, uint32_t> _drawPixels;
+	vector<uint32_t> _drawBuffer;
+	vector<uint32_t> _prevDrawBuffer;
 
 public:
 	DebugHud();
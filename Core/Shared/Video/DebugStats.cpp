@@ -6,6 +6,7 @@
 #include "Shared/Emulator.h"
 #include "Shared/RewindManager.h"
 #include "Shared/EmuSettings.h"
+#include "Shared/FrameTimingStats.h"
 
 void DebugStats::DisplayStats(Emulator *emu, double lastFrameTime)
 {
@@ -103,4 +104,48 @@ void DebugStats::DisplayStats(Emulator *emu, double lastFrameTime)
 		ss << "   Per min.: " << std::fixed << std::setprecision(2) << (memUsage * 60 * 60 / rewindStats.HistoryDuration) << " MB";
 		hud->DrawString(9, 82, ss.str(), 0xFFFFFF, 0xFF000000, 1, startFrame);
 	}
+
+	DrawLatencyStats(emu, hud, startFrame);
+}
+
+void DebugStats::DrawLatencyStats(Emulator* emu, DebugHud* hud, int startFrame)
+{
+	hud->DrawRectangle(8, 97, 243, 67, 0x40000000, true, 1, startFrame);
+	hud->DrawRectangle(8, 97, 243, 67, 0xFFFFFF, false, 1, startFrame);
+	hud->DrawString(10, 99, "Frame Latency", 0xFFFFFF, 0xFF000000, 1, startFrame);
+	hud->DrawString(120, 99, "Avg.", 0xFFFFFF, 0xFF000000, 1, startFrame);
+	hud->DrawString(180, 99, "95%", 0xFFFFFF, 0xFF000000, 1, startFrame);
+
+	FrameTimingStats* timings = emu->GetFrameTimings();
+	constexpr FrameStage stages[] = { FrameStage::Emulation, FrameStage::Decode, FrameStage::Filter, FrameStage::Present };
+	constexpr const char* names[] = { "Emulation", "Decode", "Filter", "Present" };
+
+	//Time between the moment the input is polled and the moment the frame is displayed
+	double totalAverage = 0;
+	double totalPercentile = 0;
+	int y = 110;
+	for(int i = 0; i < 4; i++) {
+		FrameStageStats stats = timings->GetStats(stages[i]);
+		DrawStageStats(hud, y, names[i], stats.Average, stats.Percentile95, startFrame);
+		totalAverage += stats.Average;
+		totalPercentile += stats.Percentile95;
+		y += 9;
+	}
+	DrawStageStats(hud, y, "Total", totalAverage, totalPercentile, startFrame);
+
+	FrameStageStats waitStats = timings->GetStats(FrameStage::Wait);
+	DrawStageStats(hud, y + 9, "Idle", waitStats.Average, waitStats.Percentile95, startFrame);
+}
+
+void DebugStats::DrawStageStats(DebugHud* hud, int y, string name, double average, double percentile, int startFrame)
+{
+	hud->DrawString(10, y, name + ":", 0xFFFFFF, 0xFF000000, 1, startFrame);
+
+	std::stringstream ss;
+	ss << std::fixed << std::setprecision(2) << average << " ms";
+	hud->DrawString(120, y, ss.str(), 0xFFFFFF, 0xFF000000, 1, startFrame);
+
+	ss = std::stringstream();
+	ss << std::fixed << std::setprecision(2) << percentile << " ms";
+	hud->DrawString(180, y, ss.str(), 0xFFFFFF, 0xFF000000, 1, startFrame);
 }
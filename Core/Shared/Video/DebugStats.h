@@ -2,6 +2,7 @@
 #include "pch.h"
 
 class Emulator;
+class DebugHud;
 
 class DebugStats
 {
@@ -11,6 +12,9 @@ private:
 	double _lastFrameMin = 9999;
 	double _lastFrameMax = 0;
 
+	void DrawLatencyStats(Emulator* emu, DebugHud* hud, int startFrame);
+	void DrawStageStats(DebugHud* hud, int y, string name, double average, double percentile, int startFrame);
+
 public:
 	void DisplayStats(Emulator *emu, double lastFrameTime);
 };
\ No newline at end of file
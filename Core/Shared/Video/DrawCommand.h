@@ -9,7 +9,6 @@ private:
 	int32_t _startFrame = 0;
 
 protected:
-	unordered_map<uint32_t, uint32_t>* _drawnPixels = nullptr;
 	uint32_t* _argbBuffer = nullptr;
 	FrameInfo _frameInfo = {};
 	OverscanDimensions _overscan = {};
@@ -21,33 +20,16 @@ protected:
 
 	__forceinline void InternalDrawPixel(int32_t offset, int color, uint32_t alpha)
 	{
-		if(_drawnPixels) {
-			//Log modified pixels
-			if(alpha != 0xFF000000) {
-				if(_drawnPixels->find(offset) == _drawnPixels->end()) {
-					//When drawing on an empty background, premultiply channels & preserve alpha value
-					//This is needed for hardware blending between the HUD and the game screen
-					(*_drawnPixels)[offset] = color;
-					BlendColors((uint8_t*)&(*_drawnPixels)[offset], (uint8_t*)&color, true);
-				} else {
-					BlendColors((uint8_t*)&(*_drawnPixels)[offset], (uint8_t*)&color);
-				}
+		if(alpha != 0xFF000000) {
+			if(_argbBuffer[offset] == 0) {
+				//When drawing on an empty background, premultiply channels & preserve alpha value
+				//This is needed for hardware blending between the HUD and the game screen
+				BlendColors((uint8_t*)&_argbBuffer[offset], (uint8_t*)&color, true);
 			} else {
-				(*_drawnPixels)[offset] = color;
+				BlendColors((uint8_t*)&_argbBuffer[offset], (uint8_t*)&color);
 			}
 		} else {
-			//Draw pixels directly to the buffer
-			if(alpha != 0xFF000000) {
-				if(_argbBuffer[offset] == 0) {
-					//When drawing on an empty background, premultiply channels & preserve alpha value
-					//This is needed for hardware blending between the HUD and the game screen
-					BlendColors((uint8_t*)&_argbBuffer[offset], (uint8_t*)&color, true);
-				} else {
-					BlendColors((uint8_t*)&_argbBuffer[offset], (uint8_t*)&color);
-				}
-			} else {
-				_argbBuffer[offset] = color;
-			}
+			_argbBuffer[offset] = color;
 		}
 	}
 
@@ -96,6 +78,26 @@ protected:
 		}
 	}
 
+	void DrawHorizontalLine(int32_t x, int32_t y, int32_t width, int color)
+	{
+		if(_yScale == 1 && _xScale == 1 && (color & 0xFF000000) == 0xFF000000) {
+			//Opaque line without scaling, clip it and fill the whole span at once
+			int32_t top = (int32_t)_overscan.Top;
+			int32_t left = (int32_t)_overscan.Left;
+			int32_t start = std::max(x, left);
+			int32_t end = std::min(x + width, left + (int32_t)_frameInfo.Width);
+			if(y < top || y - top >= (int32_t)_frameInfo.Height || start >= end) {
+				return;
+			}
+
+			std::fill_n(_argbBuffer + (y - top) * _frameInfo.Width + start - left, end - start, (uint32_t)color);
+		} else {
+			for(int32_t i = 0; i < width; i++) {
+				DrawPixel(x + i, y, color);
+			}
+		}
+	}
+
 	__forceinline void BlendColors(uint8_t output[4], uint8_t input[4], bool keepAlpha = false)
 	{
 		uint8_t alpha = input[3] + 1;
@@ -122,7 +124,7 @@ public:
 	{
 	}
 
-	void Draw(unordered_map<uint32_t, uint32_t>* drawnPixels, uint32_t* argbBuffer, FrameInfo frameInfo, OverscanDimensions &overscan, uint32_t frameNumber, HudScaleFactors &scaleFactors)
+	void Draw(uint32_t* argbBuffer, FrameInfo frameInfo, OverscanDimensions &overscan, uint32_t frameNumber, HudScaleFactors &scaleFactors)
 	{
 		if(_startFrame < 0) {
 			//When no start frame was specified, start on the next drawn frame
@@ -131,7 +133,6 @@ public:
 
 		if(_startFrame <= (int32_t)frameNumber) {
 			_argbBuffer = argbBuffer;
-			_drawnPixels = drawnPixels;
 			_frameInfo = frameInfo;
 			_overscan = overscan;
 
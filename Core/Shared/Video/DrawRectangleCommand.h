@@ -13,15 +13,11 @@ protected:
 	{
 		if(_fill) {
 			for(int j = 0; j < _height; j++) {
-				for(int i = 0; i < _width; i++) {
-					DrawPixel(_x + i, _y + j, _color);
-				}
+				DrawHorizontalLine(_x, _y + j, _width, _color);
 			}
 		} else {
-			for(int i = 0; i < _width; i++) {
-				DrawPixel(_x + i, _y, _color);
-				DrawPixel(_x + i, _y + _height - 1, _color);
-			}
+			DrawHorizontalLine(_x, _y, _width, _color);
+			DrawHorizontalLine(_x, _y + _height - 1, _width, _color);
 			for(int i = 1; i < _height - 1; i++) {
 				DrawPixel(_x, _y + i, _color);
 				DrawPixel(_x + _width - 1, _y + i, _color);
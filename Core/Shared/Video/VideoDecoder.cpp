@@ -6,6 +6,9 @@
 #include "Shared/NotificationManager.h"
 #include "Shared/Emulator.h"
 #include "Shared/RewindManager.h"
+#include "Shared/FrameTimingStats.h"
+#include "Shared/PerformanceCounters.h"
+#include "Utilities/Timer.h"
 #include "Shared/EmuSettings.h"
 #include "Shared/SettingTypes.h"
 #include "Shared/Video/ScaleFilter.h"
@@ -92,6 +95,7 @@ void VideoDecoder::UpdateVideoFilter()
 
 void VideoDecoder::DecodeFrame(bool forRewind)
 {
+	Timer stageTimer;
 	UpdateVideoFilter();
 
 	bool isAudioPlayer = _emu->GetAudioPlayerHud() != nullptr;
@@ -106,6 +110,7 @@ void VideoDecoder::DecodeFrame(bool forRewind)
 
 	_videoFilter->SetBaseFrameInfo(_baseFrameSize);
 	FrameInfo frameSize = _videoFilter->SendFrame((uint16_t*)_frame.FrameBuffer, _frame.FrameNumber, _frame.VideoPhase, _frame.Data);
+	double decodeTime = stageTimer.GetElapsedMS();
 
 	uint32_t* outputBuffer = _videoFilter->GetOutputBuffer();
 	
@@ -132,6 +137,16 @@ void VideoDecoder::DecodeFrame(bool forRewind)
 		ScanlineFilter::ApplyFilter(outputBuffer, frameSize.Width, frameSize.Height, _emu->GetSettings()->GetVideoConfig().ScanlineIntensity, scale);
 	}
 
+	double filterTime = stageTimer.GetElapsedMS() - decodeTime;
+	PerformanceCounters* perfCounters = _emu->GetPerformanceCounters();
+	perfCounters->AddTime(PerfCounter::VideoDecode, (uint64_t)(decodeTime * 1000000));
+	perfCounters->AddTime(PerfCounter::VideoFilter, (uint64_t)(filterTime * 1000000));
+	if(!forRewind) {
+		FrameTimingStats* timings = _emu->GetFrameTimings();
+		timings->AddSample(FrameStage::Decode, decodeTime);
+		timings->AddSample(FrameStage::Filter, filterTime);
+	}
+
 	RenderedFrame convertedFrame((void*)outputBuffer, frameSize.Width, frameSize.Height, _frame.Scale, _frame.FrameNumber, _frame.InputData);
 
 	double aspectRatio = _emu->GetSettings()->GetAspectRatio(_emu->GetRegion(), _baseFrameSize);
@@ -4,6 +4,9 @@
 #include "Shared/Interfaces/IRenderingDevice.h"
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
+#include "Shared/FrameTimingStats.h"
+#include "Shared/PerformanceCounters.h"
+#include "Utilities/Timer.h"
 #include "Shared/Video/DebugHud.h"
 #include "Shared/Video/SystemHud.h"
 #include "Shared/InputHud.h"
@@ -11,6 +14,8 @@
 #include "Utilities/Video/IVideoRecorder.h"
 #include "Utilities/Video/AviRecorder.h"
 #include "Utilities/Video/GifRecorder.h"
+#include "Utilities/Video/RawStreamRecorder.h"
+#include "Utilities/Video/PngSequenceRecorder.h"
 
 VideoRenderer::VideoRenderer(Emulator* emu)
 {
@@ -102,7 +107,14 @@ void VideoRenderer::RenderThread()
 
 			if(forceRender || _needRedraw || _emuHudSurface.IsDirty || _scriptHudSurface.IsDirty) {
 				_needRedraw = false;
+				Timer presentTimer;
 				_renderer->Render(_emuHudSurface, _scriptHudSurface);
+				double presentTime = presentTimer.GetElapsedMS();
+				_emu->GetPerformanceCounters()->AddTime(PerfCounter::Present, (uint64_t)(presentTime * 1000000));
+				if(!forceRender) {
+					//Only measure the time taken to present new frames
+					_emu->GetFrameTimings()->AddSample(FrameStage::Present, presentTime);
+				}
 			}
 		}
 	}
@@ -254,6 +266,10 @@ void VideoRenderer::StartRecording(string filename, RecordAviOptions options)
 	shared_ptr<IVideoRecorder> recorder;
 	if(options.Codec == VideoCodec::GIF) {
 		recorder.reset(new GifRecorder());
+	} else if(options.Codec == VideoCodec::RawStream) {
+		recorder.reset(new RawStreamRecorder());
+	} else if(options.Codec == VideoCodec::PngSequence) {
+		recorder.reset(new PngSequenceRecorder());
 	} else {
 		recorder.reset(new AviRecorder(options.Codec, options.CompressionLevel));
 	}
@@ -11,6 +11,7 @@
 #include "Core/Shared/ShortcutKeyHandler.h"
 #include "Core/Shared/TimingInfo.h"
 #include "Core/Shared/CheatManager.h"
+#include "Core/Shared/PerformanceCounters.h"
 #include "Core/Shared/DebuggerRequest.h"
 #include "Core/Netplay/GameClient.h"
 #include "Core/Netplay/GameServer.h"
@@ -170,6 +171,9 @@ extern "C" {
 
 	DllExport void __stdcall TakeScreenshot() { _emu->GetVideoDecoder()->TakeScreenshot(); }
 
+	DllExport uint32_t __stdcall GetPerformanceCounters(PerfCounterFrame* frames, uint32_t maxCount) { return _emu->GetPerformanceCounters()->GetHistory(frames, maxCount); }
+	DllExport bool __stdcall SavePerformanceCounters(char* filename) { return _emu->GetPerformanceCounters()->SaveHistory(filename); }
+
 	DllExport void __stdcall ProcessAudioPlayerAction(AudioPlayerActionParams p) { _emu->ProcessAudioPlayerAction(p); }
 
 	DllExport void __stdcall GetArchiveRomList(char* filename, char* outBuffer, uint32_t maxLength) { 
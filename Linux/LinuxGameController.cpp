@@ -52,64 +52,65 @@ LinuxGameController::LinuxGameController(Emulator* emu, int deviceID, int fileDe
 {
 	_emu = emu;
 	_deviceID = deviceID;
-	_stopFlag = false;
+	_disconnected = false;
 	_device = device;
 	_fd = fileDescriptor;
 	memset(_axisDefaultValue, 0, sizeof(_axisDefaultValue));
 
-	_eventThread = std::thread([=]() {
-		int rc;
-		bool calibrate = true;
-
-		do {
-			fd_set readSet;
-			FD_ZERO(&readSet);
-			FD_SET(_fd, &readSet);
+	//libevdev reads the current value of each axis when the device is opened
+	Calibrate();
+	UpdateState();
+}
 
-			//Timeout after 0.1 seconds (to allow thread to be terminated quickly)
-			timeval timeout;
-			timeout.tv_sec = 0;
-			timeout.tv_usec = 100000;
+LinuxGameController::~LinuxGameController()
+{
+	libevdev_free(_device);
+	close(_fd);
+}
 
-			rc = select((int)_fd+1, &readSet, nullptr, nullptr, &timeout);
-			if(rc) {
-				do {
-					struct input_event ev;
-					rc = libevdev_next_event(_device, LIBEVDEV_READ_FLAG_NORMAL, &ev);
-					if(rc == LIBEVDEV_READ_STATUS_SYNC) {
-						while (rc == LIBEVDEV_READ_STATUS_SYNC) {
-							rc = libevdev_next_event(_device, LIBEVDEV_READ_FLAG_SYNC, &ev);
-						}
-					} else if(rc == LIBEVDEV_READ_STATUS_SUCCESS) {
-						//print_event(&ev);
-					}
-				} while(rc == LIBEVDEV_READ_STATUS_SYNC || rc == LIBEVDEV_READ_STATUS_SUCCESS);
-			} 
-			
-			if(rc != LIBEVDEV_READ_STATUS_SYNC && rc != LIBEVDEV_READ_STATUS_SUCCESS && rc != -EAGAIN && rc != EWOULDBLOCK) {
-				//Device was disconnected
-				MessageManager::Log("[Input Device] Disconnected");
-				break;
+bool LinuxGameController::ProcessEvents()
+{
+	int rc;
+	do {
+		struct input_event ev;
+		rc = libevdev_next_event(_device, LIBEVDEV_READ_FLAG_NORMAL, &ev);
+		if(rc == LIBEVDEV_READ_STATUS_SYNC) {
+			while (rc == LIBEVDEV_READ_STATUS_SYNC) {
+				rc = libevdev_next_event(_device, LIBEVDEV_READ_FLAG_SYNC, &ev);
 			}
+		} else if(rc == LIBEVDEV_READ_STATUS_SUCCESS) {
+			//print_event(&ev);
+		}
+	} while(rc == LIBEVDEV_READ_STATUS_SYNC || rc == LIBEVDEV_READ_STATUS_SUCCESS);
 
-			if(calibrate) {
-				std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(100));
-				Calibrate();
-				calibrate = false;
-			}			
-		} while(!_stopFlag);
-
+	if(rc != -EAGAIN && rc != -EWOULDBLOCK) {
+		//Device was disconnected
+		MessageManager::Log("[Input Device] Disconnected");
 		_disconnected = true;
-	});
+		_buttonState = 0;
+		return true;
+	}
+
+	return UpdateState();
 }
 
-LinuxGameController::~LinuxGameController()
+bool LinuxGameController::UpdateState()
 {
-	_stopFlag = true;	
-	_eventThread.join();
+	uint64_t buttonState = 0;
+	for(int i = 0; i < LinuxGameController::ButtonCount; i++) {
+		if(ReadButtonState(i)) {
+			buttonState |= (uint64_t)1 << i;
+		}
+	}
 
-	libevdev_free(_device);
-	close(_fd);
+	bool changed = false;
+	for(int i = 0; i < LinuxGameController::AxisCount; i++) {
+		int16_t position = ReadAxisPosition(i);
+		changed |= _axisState[i].exchange(position) != position;
+	}
+
+	changed |= _buttonState.exchange(buttonState) != buttonState;
+	return changed;
 }
 
 void LinuxGameController::Calibrate()
@@ -135,6 +136,14 @@ bool LinuxGameController::CheckAxis(unsigned int code, bool forPositive)
 }
 
 bool LinuxGameController::IsButtonPressed(int buttonNumber)
+{
+	if(buttonNumber < 0 || buttonNumber >= LinuxGameController::ButtonCount) {
+		return false;
+	}
+	return (_buttonState.load() >> buttonNumber) & 0x01;
+}
+
+bool LinuxGameController::ReadButtonState(int buttonNumber)
 {
 	switch(buttonNumber) {
 		case 0: return libevdev_get_event_value(_device, EV_KEY, BTN_A) == 1;
@@ -202,11 +211,18 @@ bool LinuxGameController::IsButtonPressed(int buttonNumber)
 
 optional<int16_t> LinuxGameController::GetAxisPosition(int axis)
 {
-	axis -= 55;
+	axis -= LinuxGameController::ButtonCount;
+	if(axis < 0 || axis >= LinuxGameController::AxisCount) {
+		return std::nullopt;
+	}
+	return _axisState[axis].load();
+}
 
+int16_t LinuxGameController::ReadAxisPosition(int axis)
+{
 	unsigned int code;
 	switch(axis) {
-		default: return std::nullopt;
+		default: return 0;
 		case 0: code = ABS_Y; break;
 		case 1: code = ABS_X; break;
 		case 2: code = ABS_RY; break;
@@ -221,6 +237,11 @@ optional<int16_t> LinuxGameController::GetAxisPosition(int axis)
 	int value = libevdev_get_event_value(_device, EV_ABS, code);
 
 	int range = max - min;
+	if(range == 0) {
+		//Axis is not supported by this device
+		return 0;
+	}
+
 	int offset = value - min;
 	double ratio = (double)offset / range;
 
@@ -238,6 +259,11 @@ int LinuxGameController::GetDeviceID()
 	return _deviceID;
 }
 
+int LinuxGameController::GetFileDescriptor()
+{
+	return _fd;
+}
+
 /*
 static int print_event(struct input_event *ev)
 {
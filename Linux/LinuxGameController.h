@@ -1,5 +1,4 @@
 #pragma once
-#include <thread>
 #include <atomic>
 
 struct libevdev;
@@ -11,16 +10,24 @@ private:
 	int _fd = -1;
 	int _deviceID = -1;
 	libevdev *_device = nullptr;
-	bool _disconnected = false;
-	std::thread _eventThread;
-	std::atomic<bool> _stopFlag;
+	std::atomic<bool> _disconnected;
 	Emulator* _emu;
 	int _axisDefaultValue[0x100];
 
+	//Latest state of the controller, updated by the input thread and read by the emulation/shortcut threads without locking
+	static constexpr int ButtonCount = 55;
+	static constexpr int AxisCount = 6;
+	std::atomic<uint64_t> _buttonState;
+	std::atomic<int16_t> _axisState[AxisCount];
+
 	LinuxGameController(Emulator* emu, int deviceID, int fileDescriptor, libevdev *device);
 	bool CheckAxis(unsigned int code, bool forPositive);
 	void Calibrate();	
 
+	bool ReadButtonState(int buttonNumber);
+	int16_t ReadAxisPosition(int axis);
+	bool UpdateState();
+
 public:
 	~LinuxGameController();
 
@@ -28,6 +35,11 @@ public:
 
 	bool IsDisconnected();
 	int GetDeviceID();
+	int GetFileDescriptor();
+
+	//Reads all pending events from the device, returns true if a button or axis changed
+	bool ProcessEvents();
+
 	bool IsButtonPressed(int buttonNumber);
 	optional<int16_t> GetAxisPosition(int axis);
 };
\ No newline at end of file
@@ -1,8 +1,13 @@
 ﻿#include <algorithm>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
 #include "LinuxKeyManager.h"
 #include "LinuxGameController.h"
 #include "Utilities/FolderUtilities.h"
 #include "Shared/Emulator.h"
+#include "Shared/KeyManager.h"
 #include "Shared/KeyDefinitions.h"
 
 LinuxKeyManager::LinuxKeyManager(Emulator* emu)
@@ -38,24 +43,33 @@ LinuxKeyManager::LinuxKeyManager(Emulator* emu)
 		_keyCodes[keyDef.name] = keyDef.keyCode;
 	}
 
-	CheckForGamepads(true);
+	_controllers = CheckForGamepads(true);
 
 	_disableAllKeys = false;
-	_stopUpdateDeviceThread = false;
-	StartUpdateDeviceThread();	
+	_stopInputThread = false;
+	StartInputThread();	
 }
 
 LinuxKeyManager::~LinuxKeyManager()
 {
-	_stopUpdateDeviceThread = true;
-	_stopSignal.Signal();
-	_updateDeviceThread.join();
+	_stopInputThread = true;
+	if(_wakeupFd >= 0) {
+		uint64_t value = 1;
+		[[maybe_unused]] ssize_t result = write(_wakeupFd, &value, sizeof(value));
+	}
+	_inputThread.join();
+
+	if(_wakeupFd >= 0) {
+		close(_wakeupFd);
+	}
+	if(_deviceWatchFd >= 0) {
+		close(_deviceWatchFd);
+	}
 }
 
 void LinuxKeyManager::RefreshState()
 {
-	//TODO: NOT IMPLEMENTED YET
-	//Only needed to detect poll controller input
+	//Gamepad states are updated by the input thread as events are received
 }
 
 bool LinuxKeyManager::IsKeyPressed(uint16_t key)
@@ -134,8 +148,9 @@ void LinuxKeyManager::UpdateDevices()
 	//Only needed to detect newly plugged in devices
 }
 
-void LinuxKeyManager::CheckForGamepads(bool logInformation)
+vector<shared_ptr<LinuxGameController>> LinuxKeyManager::CheckForGamepads(bool logInformation)
 {
+	vector<shared_ptr<LinuxGameController>> newControllers;
 	vector<int> connectedIDs; 
 	for(int i = _controllers.size() - 1; i >= 0; i--) {
 		if(!_controllers[i]->IsDisconnected()) {
@@ -157,48 +172,96 @@ void LinuxKeyManager::CheckForGamepads(bool logInformation)
 			if(std::find(connectedIDs.begin(), connectedIDs.end(), deviceId) == connectedIDs.end()) {
 				std::shared_ptr<LinuxGameController> controller = LinuxGameController::GetController(_emu, deviceId, logInformation);
 				if(controller) {
-					_controllers.push_back(controller);
+					newControllers.push_back(controller);
 				}
 			}
 		}
 	}
+	return newControllers;
 }
 
-void LinuxKeyManager::StartUpdateDeviceThread()
+void LinuxKeyManager::UpdateControllerList()
 {
-	_updateDeviceThread = std::thread([=]() {
-		while(!_stopUpdateDeviceThread) {
-			//Check for newly plugged in controllers every 5 secs
-			vector<shared_ptr<LinuxGameController>> controllersToAdd; 
-			vector<int> indexesToRemove;
-			for(int i = _controllers.size() - 1; i >= 0; i--) {
-				if(_controllers[i]->IsDisconnected()) {
-					indexesToRemove.push_back(i);
-				}
+	vector<shared_ptr<LinuxGameController>> controllersToAdd = CheckForGamepads(false);
+	bool hasDisconnectedControllers = std::any_of(_controllers.begin(), _controllers.end(), [](shared_ptr<LinuxGameController>& controller) {
+		return controller->IsDisconnected();
+	});
+
+	if(hasDisconnectedControllers || !controllersToAdd.empty()) {
+		_emu->Pause();
+		_controllers.erase(std::remove_if(_controllers.begin(), _controllers.end(), [](shared_ptr<LinuxGameController>& controller) {
+			return controller->IsDisconnected();
+		}), _controllers.end());
+		for(shared_ptr<LinuxGameController>& controller : controllersToAdd) {
+			_controllers.push_back(controller);
+		}
+		_emu->Resume();
+	}
+}
+
+void LinuxKeyManager::StartInputThread()
+{
+	_wakeupFd = eventfd(0, EFD_NONBLOCK);
+
+	//Watch for devices being added (or their permissions changing), instead of only checking every 5 seconds
+	_deviceWatchFd = inotify_init1(IN_NONBLOCK);
+	if(_deviceWatchFd >= 0 && inotify_add_watch(_deviceWatchFd, "/dev/input/", IN_CREATE | IN_ATTRIB) < 0) {
+		close(_deviceWatchFd);
+		_deviceWatchFd = -1;
+	}
+
+	_inputThread = std::thread([=]() {
+		vector<pollfd> fds;
+		while(!_stopInputThread) {
+			fds.clear();
+			fds.push_back({ _wakeupFd, POLLIN, 0 });
+			fds.push_back({ _deviceWatchFd, POLLIN, 0 });
+			for(shared_ptr<LinuxGameController>& controller : _controllers) {
+				fds.push_back({ controller->GetFileDescriptor(), POLLIN, 0 });
 			}
 
-			CheckForGamepads(false);
+			//Check for newly plugged in controllers every 5 secs, in case the inotify events are not received
+			int result = poll(fds.data(), fds.size(), 5000);
+			if(_stopInputThread) {
+				break;
+			}
 
-			if(!indexesToRemove.empty() || !controllersToAdd.empty()) {
-				_emu->Pause();
-				for(int index : indexesToRemove) {
-					_controllers.erase(_controllers.begin()+index);
+			bool inputChanged = false;
+			bool updateControllers = result == 0;
+			for(size_t i = 2; i < fds.size(); i++) {
+				if(fds[i].revents) {
+					shared_ptr<LinuxGameController>& controller = _controllers[i - 2];
+					inputChanged |= controller->ProcessEvents();
+					if(controller->IsDisconnected() || (fds[i].revents & (POLLERR | POLLHUP | POLLNVAL))) {
+						updateControllers = true;
+					}
 				}
-				for(std::shared_ptr<LinuxGameController> controller : controllersToAdd) {
-					_controllers.push_back(controller);
-				} 
-				_emu->Resume();
 			}
 
-			_stopSignal.Wait(5000);
+			if(inputChanged) {
+				KeyManager::NotifyInputChanged();
+			}
+
+			if(fds[1].revents & POLLIN) {
+				//Discard the inotify events, the folder is scanned again below
+				char buffer[4096];
+				while(read(_deviceWatchFd, buffer, sizeof(buffer)) > 0) {}
+				updateControllers = true;
+			}
+
+			if(updateControllers) {
+				UpdateControllerList();
+			}
 		}
 	});
-}	
+}
 
 bool LinuxKeyManager::SetKeyState(uint16_t scanCode, bool state)
 {
+	//Keyboard keys and mouse buttons are sent by the UI
 	if(scanCode < 0x205 && _keyState[scanCode] != state) {
 		_keyState[scanCode] = state;
+		KeyManager::NotifyInputChanged();
 		return true;
 	}
 	return false;
@@ -207,6 +270,7 @@ bool LinuxKeyManager::SetKeyState(uint16_t scanCode, bool state)
 void LinuxKeyManager::ResetKeyState()
 {
 	memset(_keyState, 0, sizeof(_keyState));
+	KeyManager::NotifyInputChanged();
 }
 
 void LinuxKeyManager::SetDisabled(bool disabled)
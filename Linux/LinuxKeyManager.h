@@ -2,7 +2,6 @@
 #include <unordered_map>
 #include <vector>
 #include <thread>
-#include "Utilities/AutoResetEvent.h"
 #include "Shared/Interfaces/IKeyManager.h"
 #include "Shared/KeyDefinitions.h"
 
@@ -20,19 +19,23 @@ private:
 	std::unordered_map<uint16_t, string> _keyNames;
 	std::unordered_map<string, uint16_t> _keyCodes;
 
-	std::thread _updateDeviceThread;
-	atomic<bool> _stopUpdateDeviceThread; 
-	AutoResetEvent _stopSignal;
+	//A single thread waits for events on all gamepads, and for new devices in /dev/input/
+	std::thread _inputThread;
+	atomic<bool> _stopInputThread; 
+	int _wakeupFd = -1;
+	int _deviceWatchFd = -1;
 	bool _disableAllKeys;
 
-	void StartUpdateDeviceThread();
-	void CheckForGamepads(bool logInformation);
+	void StartInputThread();
+	void UpdateControllerList();
+	vector<shared_ptr<LinuxGameController>> CheckForGamepads(bool logInformation);
 
 public:
 	LinuxKeyManager(Emulator* emu);
 	virtual ~LinuxKeyManager();
 
 	void RefreshState() override;
+	bool IsPollingRequired() override { return false; }
 	bool IsKeyPressed(uint16_t key) override;
 	optional<int16_t> GetAxisPosition(uint16_t key) override;
 	bool IsMouseButtonPressed(MouseButton button) override;
@@ -1,4 +1,5 @@
-﻿using ReactiveUI.Fody.Helpers;
+﻿using Mesen.Utilities;
+using ReactiveUI.Fody.Helpers;
 using System;
 using System.Collections.Generic;
 using System.Linq;
@@ -20,6 +21,21 @@ namespace Mesen.Config
 		None = 0,
 		ZMBV = 1,
 		CSCD = 2,
-		GIF = 3
+		GIF = 3,
+		RawStream = 4,
+		PngSequence = 5
+	}
+
+	public static class VideoCodecExtensions
+	{
+		public static string GetFileExtension(this VideoCodec codec)
+		{
+			return codec switch {
+				VideoCodec.GIF => FileDialogHelper.GifExt,
+				VideoCodec.RawStream => FileDialogHelper.RawExt,
+				VideoCodec.PngSequence => FileDialogHelper.PngExt,
+				_ => FileDialogHelper.AviExt
+			};
+		}
 	}
 }
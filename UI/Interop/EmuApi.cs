@@ -59,6 +59,17 @@ namespace Mesen.Interop
 
 		[DllImport(DllPath)] public static extern void TakeScreenshot();
 
+		[DllImport(DllPath, EntryPoint = "GetPerformanceCounters")] private static extern UInt32 GetPerformanceCountersWrapper([In, Out] PerfCounterFrame[] frames, UInt32 maxCount);
+		public static PerfCounterFrame[] GetPerformanceCounters(UInt32 maxCount = 600)
+		{
+			PerfCounterFrame[] frames = new PerfCounterFrame[maxCount];
+			UInt32 count = EmuApi.GetPerformanceCountersWrapper(frames, maxCount);
+			Array.Resize(ref frames, (int)count);
+			return frames;
+		}
+
+		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool SavePerformanceCounters([MarshalAs(UnmanagedType.LPUTF8Str)]string filename);
+
 		[DllImport(DllPath)] public static extern void ProcessAudioPlayerAction(AudioPlayerActionParams p);
 
 		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool LoadRom(
@@ -145,6 +156,27 @@ namespace Mesen.Interop
 		public UInt32 CycleCount;
 	}
 
+	public enum PerfCounter
+	{
+		Emulation,
+		AudioMixing,
+		VideoDecode,
+		VideoFilter,
+		Present,
+		Rewind,
+		Netplay,
+		Script
+	}
+
+	public struct PerfCounterFrame
+	{
+		[MarshalAs(UnmanagedType.ByValArray, SizeConst = 8)]
+		public double[] Time;
+		[MarshalAs(UnmanagedType.ByValArray, SizeConst = 8)]
+		public UInt32[] Calls;
+		public UInt32 FrameNumber;
+	}
+
 	public struct FrameInfo
 	{
 		public UInt32 Width;
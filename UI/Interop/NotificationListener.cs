@@ -85,7 +85,8 @@ namespace Mesen.Interop
 		GameLoadFailed,
 		CheatsChanged,
 		RequestConfigChange,
-		RefreshSoftwareRenderer
+		RefreshSoftwareRenderer,
+		StateSaved
 	}
 
 	public struct GameLoadedEventParams
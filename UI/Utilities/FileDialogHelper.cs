@@ -23,6 +23,7 @@ namespace Mesen.Utilities
 		public const string ZipExt = "zip";
 		public const string GifExt = "gif";
 		public const string AviExt = "avi";
+		public const string RawExt = "raw";
 		public const string WaveExt = "wav";
 		public const string MesenSaveStateExt = "mss";
 		public const string WatchFileExt = "txt";
@@ -172,7 +172,7 @@ namespace Mesen.Utilities
 			if(RecordApi.AviIsRecording()) {
 				RecordApi.AviStop();
 			} else {
-				string filename = GetOutputFilename(ConfigManager.AviFolder, ConfigManager.Config.VideoRecord.Codec == VideoCodec.GIF ? ".gif" : ".avi");
+				string filename = GetOutputFilename(ConfigManager.AviFolder, "." + ConfigManager.Config.VideoRecord.Codec.GetFileExtension());
 				RecordApi.AviRecord(filename, new RecordAviOptions() {
 					Codec = ConfigManager.Config.VideoRecord.Codec,
 					CompressionLevel = ConfigManager.Config.VideoRecord.CompressionLevel,
@@ -19,14 +19,13 @@ namespace Mesen.ViewModels
 		{
 			Config = ConfigManager.Config.VideoRecord.Clone();
 
-			SavePath = Path.Join(ConfigManager.AviFolder, EmuApi.GetRomInfo().GetRomName() + (Config.Codec == VideoCodec.GIF ? ".gif" : ".avi"));
+			SavePath = Path.Join(ConfigManager.AviFolder, EmuApi.GetRomInfo().GetRomName() + "." + Config.Codec.GetFileExtension());
 
 			this.WhenAnyValue(x => x.Config.Codec).Select(x => x == VideoCodec.ZMBV || x == VideoCodec.CSCD).ToPropertyEx(this, x => x.CompressionAvailable);
 			this.WhenAnyValue(x => x.Config.Codec).Subscribe((codec) => {
-				if(codec == VideoCodec.GIF && Path.GetExtension(SavePath).ToLowerInvariant() != ".gif") {
-					SavePath = Path.ChangeExtension(SavePath, ".gif");
-				} else if(codec != VideoCodec.GIF && Path.GetExtension(SavePath).ToLowerInvariant() == ".gif") {
-					SavePath = Path.ChangeExtension(SavePath, ".avi");
+				string ext = "." + codec.GetFileExtension();
+				if(Path.GetExtension(SavePath).ToLowerInvariant() != ext) {
+					SavePath = Path.ChangeExtension(SavePath, ext);
 				}
 			});
 		}
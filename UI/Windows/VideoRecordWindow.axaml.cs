@@ -28,10 +28,10 @@ namespace Mesen.Windows
 		private async void OnBrowseClick(object sender, RoutedEventArgs e)
 		{
 			VideoRecordConfigViewModel model = (VideoRecordConfigViewModel)DataContext!;
-			bool isGif = model.Config.Codec == VideoCodec.GIF;
+			string ext = model.Config.Codec.GetFileExtension();
 
-			string initFilename = EmuApi.GetRomInfo().GetRomName() + (isGif ? ".gif" : ".avi");
-			string? filename = await FileDialogHelper.SaveFile(ConfigManager.AviFolder, initFilename, VisualRoot, isGif ? FileDialogHelper.GifExt : FileDialogHelper.AviExt);
+			string initFilename = EmuApi.GetRomInfo().GetRomName() + "." + ext;
+			string? filename = await FileDialogHelper.SaveFile(ConfigManager.AviFolder, initFilename, VisualRoot, ext);
 			
 			if(filename != null) {
 				model.SavePath = filename;
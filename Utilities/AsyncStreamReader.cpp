@@ -0,0 +1,195 @@
+#include "pch.h"
+#include "Utilities/AsyncStreamReader.h"
+
+AsyncStreamReader::AsyncStreamReader()
+{
+}
+
+AsyncStreamReader::~AsyncStreamReader()
+{
+	Close();
+}
+
+bool AsyncStreamReader::Open(const string& path)
+{
+	Close();
+
+	ifstream file(path, std::ios::in | std::ios::binary);
+	if(!file) {
+		return false;
+	}
+
+	file.seekg(0, std::ios::end);
+	_fileSize = (uint32_t)file.tellg();
+	_path = path;
+	_position = 0;
+	_stopFlag = false;
+	for(Block& block : _blocks) {
+		block = {};
+	}
+
+	_thread.reset(new std::thread(&AsyncStreamReader::ReadThread, this));
+
+	//Start loading the beginning of the file right away
+	Seek(0);
+	return true;
+}
+
+void AsyncStreamReader::Stop()
+{
+	if(_thread) {
+		{
+			std::lock_guard<std::mutex> lock(_lock);
+			_stopFlag = true;
+		}
+		_signal.notify_all();
+		_thread->join();
+		_thread.reset();
+	}
+}
+
+void AsyncStreamReader::Close()
+{
+	Stop();
+	_current = nullptr;
+	_currentStart = 0;
+	_currentEnd = 0;
+	_fileSize = 0;
+	_position = 0;
+}
+
+void AsyncStreamReader::RequestBlock(Block& block, uint32_t start)
+{
+	//Lock must be held by the caller
+	if(start >= _fileSize) {
+		//Nothing to load past the end of the file
+		return;
+	}
+
+	if(block.Start != start) {
+		block.Start = start;
+		block.Ready = false;
+		_signal.notify_all();
+	}
+}
+
+void AsyncStreamReader::Seek(uint32_t position)
+{
+	_position = position;
+	if(!_thread || _position >= _fileSize || (_position >= _currentStart && _position < _currentEnd)) {
+		return;
+	}
+
+	//Queue the load for the target block, but don't wait for it
+	uint32_t start = position / BlockSize * BlockSize;
+	std::lock_guard<std::mutex> lock(_lock);
+	for(Block& block : _blocks) {
+		if(block.Start == start) {
+			return;
+		}
+	}
+	RequestBlock(_current == &_blocks[0] ? _blocks[1] : _blocks[0], start);
+}
+
+bool AsyncStreamReader::LoadCurrentBlock()
+{
+	//Makes the block that contains _position the current block, waiting for it to be loaded if needed
+	if(!_thread || _position >= _fileSize) {
+		return false;
+	}
+
+	uint32_t start = _position / BlockSize * BlockSize;
+
+	std::unique_lock<std::mutex> lock(_lock);
+	Block* target = nullptr;
+	for(Block& block : _blocks) {
+		if(block.Start == start) {
+			target = &block;
+		}
+	}
+
+	if(!target) {
+		target = (_current == &_blocks[0]) ? &_blocks[1] : &_blocks[0];
+		RequestBlock(*target, start);
+	}
+
+	_signal.wait(lock, [=] { return target->Ready || _stopFlag; });
+	if(!target->Ready || target->Size == 0) {
+		return false;
+	}
+
+	_current = target;
+	_currentStart = start;
+	_currentEnd = start + target->Size;
+
+	//Prefetch the next block in the other buffer
+	uint32_t nextStart = start + BlockSize;
+	if(nextStart < _fileSize) {
+		RequestBlock(target == &_blocks[0] ? _blocks[1] : _blocks[0], nextStart);
+	}
+	return true;
+}
+
+uint32_t AsyncStreamReader::Read(uint8_t* dst, uint32_t length)
+{
+	uint32_t bytesRead = 0;
+	while(bytesRead < length) {
+		if(_position < _currentStart || _position >= _currentEnd) {
+			if(!LoadCurrentBlock()) {
+				break;
+			}
+		}
+
+		uint32_t count = std::min(length - bytesRead, _currentEnd - _position);
+		memcpy(dst + bytesRead, _current->Data.data() + (_position - _currentStart), count);
+		bytesRead += count;
+		_position += count;
+	}
+	return bytesRead;
+}
+
+void AsyncStreamReader::ReadThread()
+{
+	ifstream file(_path, std::ios::in | std::ios::binary);
+	vector<uint8_t> buffer;
+
+	std::unique_lock<std::mutex> lock(_lock);
+	while(true) {
+		Block* pending = nullptr;
+		_signal.wait(lock, [&] {
+			if(_stopFlag) {
+				return true;
+			}
+			for(Block& block : _blocks) {
+				if(block.Start >= 0 && !block.Ready) {
+					pending = &block;
+					return true;
+				}
+			}
+			return false;
+		});
+
+		if(_stopFlag) {
+			return;
+		}
+
+		int64_t start = pending->Start;
+		lock.unlock();
+
+		uint32_t size = (uint32_t)std::clamp<int64_t>((int64_t)_fileSize - start, 0, BlockSize);
+		buffer.resize(size);
+		file.clear();
+		file.seekg(start, std::ios::beg);
+		file.read((char*)buffer.data(), size);
+		size = (uint32_t)file.gcount();
+
+		lock.lock();
+		if(pending->Start == start && !pending->Ready) {
+			//The block wasn't re-requested for another position while it was loading
+			pending->Data.swap(buffer);
+			pending->Size = size;
+			pending->Ready = true;
+			_signal.notify_all();
+		}
+	}
+}
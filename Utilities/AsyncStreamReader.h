@@ -0,0 +1,73 @@
+#pragma once
+#include "pch.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+//Sequential file reader that loads the file in fixed-size blocks on a worker thread.
+//While one block is being consumed, the next one is prefetched in the other buffer, so
+//reads only block on the file system after a seek to a position that isn't loaded yet.
+//Only one thread may read from a given instance.
+class AsyncStreamReader
+{
+private:
+	static constexpr uint32_t BlockSize = 0x10000;
+
+	struct Block
+	{
+		int64_t Start = -1;
+		uint32_t Size = 0;
+		bool Ready = false;
+		vector<uint8_t> Data;
+	};
+
+	string _path;
+	uint32_t _fileSize = 0;
+	uint32_t _position = 0;
+
+	Block _blocks[2];
+
+	//Block currently being read from, can be accessed without locking
+	Block* _current = nullptr;
+	uint32_t _currentStart = 0;
+	uint32_t _currentEnd = 0;
+
+	std::mutex _lock;
+	std::condition_variable _signal;
+	unique_ptr<std::thread> _thread;
+	bool _stopFlag = false;
+
+	void ReadThread();
+	void RequestBlock(Block& block, uint32_t start);
+	bool LoadCurrentBlock();
+	void Stop();
+
+public:
+	AsyncStreamReader();
+	~AsyncStreamReader();
+
+	AsyncStreamReader(const AsyncStreamReader&) = delete;
+	AsyncStreamReader& operator=(const AsyncStreamReader&) = delete;
+
+	bool Open(const string& path);
+	void Close();
+	bool IsOpen() { return _thread != nullptr; }
+
+	uint32_t GetSize() { return _fileSize; }
+	uint32_t GetPosition() { return _position; }
+	void Seek(uint32_t position);
+
+	//Returns the number of bytes read (less than length when the end of the file is reached)
+	uint32_t Read(uint8_t* dst, uint32_t length);
+
+	__forceinline uint8_t ReadByte()
+	{
+		if(_position >= _currentStart && _position < _currentEnd) {
+			return _current->Data[_position++ - _currentStart];
+		}
+
+		uint8_t value = 0;
+		Read(&value, 1);
+		return value;
+	}
+};
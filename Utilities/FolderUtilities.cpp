@@ -152,6 +152,14 @@ void FolderUtilities::CreateFolder(string folder)
 	fs::create_directory(fs::u8path(folder), errorCode);
 }
 
+bool FolderUtilities::RenameFile(string source, string destination)
+{
+	//Replaces the destination file if it already exists
+	std::error_code errorCode;
+	fs::rename(fs::u8path(source), fs::u8path(destination), errorCode);
+	return !errorCode;
+}
+
 vector<string> FolderUtilities::GetFolders(string rootFolder)
 {
 	vector<string> folders;
@@ -38,6 +38,7 @@ public:
 	static string GetFolderName(string filepath);
 
 	static void CreateFolder(string folder);
+	static bool RenameFile(string source, string destination);
 
 	static string CombinePath(string folder, string filename);
 };
\ No newline at end of file
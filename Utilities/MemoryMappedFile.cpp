@@ -0,0 +1,96 @@
+#include "pch.h"
+#include "Utilities/MemoryMappedFile.h"
+
+#ifdef _WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#include <Windows.h>
+#else
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+	Close();
+}
+
+bool MemoryMappedFile::Open(const string& path)
+{
+	Close();
+
+	#ifdef _WIN32
+		HANDLE file = CreateFileW(utf8::utf8::decode(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if(file == INVALID_HANDLE_VALUE) {
+			return false;
+		}
+
+		LARGE_INTEGER size;
+		if(!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if(!mapping) {
+			CloseHandle(file);
+			return false;
+		}
+
+		void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if(!data) {
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return false;
+		}
+
+		_fileHandle = file;
+		_mappingHandle = mapping;
+		_data = (uint8_t*)data;
+		_size = (size_t)size.QuadPart;
+	#else
+		int fd = open(path.c_str(), O_RDONLY);
+		if(fd < 0) {
+			return false;
+		}
+
+		struct stat st;
+		if(fstat(fd, &st) != 0 || st.st_size == 0) {
+			close(fd);
+			return false;
+		}
+
+		void* data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+		//The mapping stays valid after the file descriptor is closed
+		close(fd);
+		if(data == MAP_FAILED) {
+			return false;
+		}
+
+		_data = (uint8_t*)data;
+		_size = (size_t)st.st_size;
+	#endif
+
+	return true;
+}
+
+void MemoryMappedFile::Close()
+{
+	if(!_data) {
+		return;
+	}
+
+	#ifdef _WIN32
+		UnmapViewOfFile(_data);
+		CloseHandle((HANDLE)_mappingHandle);
+		CloseHandle((HANDLE)_fileHandle);
+		_mappingHandle = nullptr;
+		_fileHandle = nullptr;
+	#else
+		munmap(_data, _size);
+	#endif
+
+	_data = nullptr;
+	_size = 0;
+}
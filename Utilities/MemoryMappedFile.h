@@ -0,0 +1,29 @@
+#pragma once
+#include "pch.h"
+
+//Read-only view of a file's content, backed by the OS' page cache
+class MemoryMappedFile
+{
+private:
+	uint8_t* _data = nullptr;
+	size_t _size = 0;
+
+	#ifdef _WIN32
+	void* _fileHandle = nullptr;
+	void* _mappingHandle = nullptr;
+	#endif
+
+public:
+	MemoryMappedFile() {}
+	~MemoryMappedFile();
+
+	MemoryMappedFile(const MemoryMappedFile&) = delete;
+	MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+	bool Open(const string& path);
+	void Close();
+
+	bool IsOpen() { return _data != nullptr; }
+	const uint8_t* GetData() { return _data; }
+	size_t GetSize() { return _size; }
+};
@@ -209,23 +209,28 @@ void Serializer::SaveTo(ostream& file, int compressionLevel)
 	if(_format == SerializeFormat::Text) {
 		file.write((char*)_data.data(), _data.size());
 	} else {
-		bool isCompressed = compressionLevel > 0;
-		file.put((char)isCompressed);
-
-		if(isCompressed) {
-			unsigned long compressedSize = compressBound((unsigned long)_data.size());
-			uint8_t* compressedData = new uint8_t[compressedSize];
-			compress2(compressedData, &compressedSize, (unsigned char*)_data.data(), (unsigned long)_data.size(), compressionLevel);
-
-			uint32_t size = (uint32_t)compressedSize;
-			uint32_t originalSize = (uint32_t)_data.size();
-			file.write((char*)&originalSize, sizeof(uint32_t));
-			file.write((char*)&size, sizeof(uint32_t));
-			file.write((char*)compressedData, compressedSize);
-			delete[] compressedData;
-		} else {
-			file.write((char*)_data.data(), _data.size());
-		}
+		SaveTo(file, _data.data(), (uint32_t)_data.size(), compressionLevel);
+	}
+}
+
+void Serializer::SaveTo(ostream& file, uint8_t* data, uint32_t dataSize, int compressionLevel)
+{
+	bool isCompressed = compressionLevel > 0;
+	file.put((char)isCompressed);
+
+	if(isCompressed) {
+		unsigned long compressedSize = compressBound((unsigned long)dataSize);
+		uint8_t* compressedData = new uint8_t[compressedSize];
+		compress2(compressedData, &compressedSize, (unsigned char*)data, (unsigned long)dataSize, compressionLevel);
+
+		uint32_t size = (uint32_t)compressedSize;
+		uint32_t originalSize = dataSize;
+		file.write((char*)&originalSize, sizeof(uint32_t));
+		file.write((char*)&size, sizeof(uint32_t));
+		file.write((char*)compressedData, compressedSize);
+		delete[] compressedData;
+	} else {
+		file.write((char*)data, dataSize);
 	}
 }
 
@@ -432,6 +432,7 @@ public:
 	void PushNamePrefix(const char* name, int index = -1);
 	void PopNamePrefix();
 	void SaveTo(ostream &file, int compressionLevel = 1);
+	static void SaveTo(ostream& file, uint8_t* data, uint32_t dataSize, int compressionLevel);
 	bool LoadFrom(istream& file);
 	void LoadFromMap(unordered_map<string, SerializeMapValue>& map);
 };
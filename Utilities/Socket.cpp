@@ -11,6 +11,8 @@ using namespace std;
 	#include <winsock2.h>
 	#include <Ws2tcpip.h>
 	#include <Windows.h>
+
+	#define poll WSAPoll
 #else
 	#include <sys/types.h>
 	#include <sys/socket.h>
@@ -21,6 +23,7 @@ using namespace std;
 	#include <netinet/tcp.h>
 	#include <netdb.h>
 	#include <unistd.h>
+	#include <poll.h>
 
 	#define INVALID_SOCKET (uintptr_t)-1
 	#define SOCKET_ERROR -1
@@ -244,6 +247,19 @@ int Socket::Send(char *buf, int len, int flags)
 	return returnVal;
 }
 
+void Socket::BufferedSend(char *buf, int len)
+{
+	_sendBuffer.insert(_sendBuffer.end(), buf, buf + len);
+}
+
+void Socket::SendBuffer()
+{
+	if(!_sendBuffer.empty()) {
+		Send((char*)_sendBuffer.data(), (int)_sendBuffer.size(), 0);
+		_sendBuffer.clear();
+	}
+}
+
 int Socket::Recv(char *buf, int len, int flags)
 {
 	int returnVal = recv(_socket, buf, len, flags);
@@ -262,3 +278,32 @@ int Socket::Recv(char *buf, int len, int flags)
 
 	return returnVal;
 }
+
+int Socket::WaitForRead(const vector<Socket*>& sockets, vector<bool>& readyFlags, int timeoutMs)
+{
+	vector<pollfd> fds(sockets.size());
+	for(size_t i = 0; i < sockets.size(); i++) {
+		Socket* socket = sockets[i];
+		//Negative fds are ignored by poll, closed sockets will not wake up the caller
+		fds[i].fd = (socket && !socket->_connectionError) ? (decltype(fds[i].fd))socket->_socket : (decltype(fds[i].fd))-1;
+		fds[i].events = POLLIN;
+		fds[i].revents = 0;
+	}
+
+	readyFlags.assign(sockets.size(), false);
+	if(fds.empty()) {
+		std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(timeoutMs));
+		return 0;
+	}
+
+	int returnVal = poll(fds.data(), (uint32_t)fds.size(), timeoutMs);
+	if(returnVal > 0) {
+		for(size_t i = 0; i < fds.size(); i++) {
+			//Errors/hangups are reported as "ready" to let the next Recv call detect them
+			readyFlags[i] = fds[i].revents != 0;
+		}
+	} else if(returnVal == SOCKET_ERROR) {
+		std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(1));
+	}
+	return returnVal;
+}
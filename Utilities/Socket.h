@@ -12,6 +12,7 @@ private:
 	uintptr_t _socket = (uintptr_t)~0;
 	bool _connectionError = false;
 	int32_t _UPnPPort = -1;
+	vector<uint8_t> _sendBuffer;
 
 public:
 	Socket();
@@ -33,4 +34,8 @@ public:
 	void BufferedSend(char *buf, int len);
 	void SendBuffer();
 	int Recv(char *buf, int len, int flags);
+
+	//Blocks until at least one of the sockets has data to read (or a connection to accept), or until the timeout expires
+	//readyFlags[i] is set to true for each socket that is ready - returns the number of ready sockets (or -1 on error)
+	static int WaitForRead(const vector<Socket*>& sockets, vector<bool>& readyFlags, int timeoutMs);
 };
@@ -4,6 +4,11 @@
 #include <thread>
 #include <chrono>
 
+#ifdef __linux__
+#include <time.h>
+#include <errno.h>
+#endif
+
 using namespace std::chrono;
 
 Timer::Timer() 
@@ -13,22 +18,47 @@ Timer::Timer()
 
 void Timer::Reset()
 {
-	_start = high_resolution_clock::now();
+	_start = steady_clock::now();
 }
 
 double Timer::GetElapsedMS() const
 {
-	high_resolution_clock::time_point end = high_resolution_clock::now();
+	steady_clock::time_point end = steady_clock::now();
 	duration<double> span = duration_cast<duration<double>>(end - _start);
 	return span.count() * 1000.0;
 }
 
 void Timer::WaitUntil(double targetMillisecond) const
 {
-	if(targetMillisecond > 0) {
-		double elapsedTime = GetElapsedMS();
-		if(targetMillisecond - elapsedTime > 1) {
-			std::this_thread::sleep_for(std::chrono::duration<int, std::milli>((int)(targetMillisecond - elapsedTime)));
+	if(targetMillisecond <= 0) {
+		return;
+	}
+
+	//Sleep until shortly before the target time, and spin for the remainder, since the OS can wake the thread up late
+#ifdef _WIN32
+	constexpr double spinTime = 1.0;
+#else
+	constexpr double spinTime = 0.25;
+#endif
+
+	steady_clock::time_point target = _start + duration_cast<steady_clock::duration>(duration<double, std::milli>(targetMillisecond));
+	steady_clock::time_point wakeTime = target - duration_cast<steady_clock::duration>(duration<double, std::milli>(spinTime));
+
+	if(wakeTime > steady_clock::now()) {
+#ifdef __linux__
+		//steady_clock uses CLOCK_MONOTONIC - sleep until an absolute deadline to avoid accumulating delays when interrupted
+		int64_t wakeNs = duration_cast<nanoseconds>(wakeTime.time_since_epoch()).count();
+		timespec ts = {};
+		ts.tv_sec = (time_t)(wakeNs / 1000000000);
+		ts.tv_nsec = (long)(wakeNs % 1000000000);
+		while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
 		}
+#else
+		std::this_thread::sleep_until(wakeTime);
+#endif
+	}
+
+	while(steady_clock::now() < target) {
+		std::this_thread::yield();
 	}
 }
@@ -6,7 +6,7 @@ using namespace std::chrono;
 class Timer
 {
 	private:
-		high_resolution_clock::time_point _start;
+		steady_clock::time_point _start;
 
 public:
 		Timer();
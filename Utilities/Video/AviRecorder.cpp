@@ -5,8 +5,6 @@ AviRecorder::AviRecorder(VideoCodec codec, uint32_t compressionLevel)
 {
 	_recording = false;
 	_stopFlag = false;
-	_framePending = false;
-	_frameBuffer = nullptr;
 	_frameBufferLength = 0;
 	_sampleRate = 0;
 	_codec = codec;
@@ -18,11 +16,6 @@ AviRecorder::~AviRecorder()
 	if(_recording) {
 		StopRecording();
 	}
-
-	if(_frameBuffer) {
-		delete[] _frameBuffer;
-		_frameBuffer = nullptr;
-	}
 }
 
 bool AviRecorder::Init(string filename)
@@ -45,7 +38,13 @@ bool AviRecorder::StartRecording(uint32_t width, uint32_t height, uint32_t bpp,
 		_height = height;
 		_fps = fps;
 		_frameBufferLength = height * width * bpp;
-		_frameBuffer = new uint8_t[_frameBufferLength];
+
+		//Keep a pool of frame buffers, to avoid stalling emulation when the encoder is temporarily slower than the emulation
+		for(int i = 0; i < AviRecorder::MaxPendingFrames; i++) {
+			_frameBuffers.push_back(std::make_unique<AviFrame>());
+			_frameBuffers.back()->FrameData.resize(_frameBufferLength);
+			_freeBuffers.push_back(_frameBuffers.back().get());
+		}
 
 		_aviWriter.reset(new AviWriter());
 		if(!_aviWriter->StartWrite(_outputFile, _codec, width, height, bpp, (uint32_t)(_fps * 1000000), audioSampleRate, _compressionLevel)) {
@@ -54,16 +53,7 @@ bool AviRecorder::StartRecording(uint32_t width, uint32_t height, uint32_t bpp,
 		}
 
 		_aviWriterThread = std::thread([=]() {
-			while(!_stopFlag) {
-				_waitFrame.Wait();
-				if(_stopFlag) {
-					break;
-				}
-
-				auto lock = _lock.AcquireSafe();
-				_aviWriter->AddFrame(_frameBuffer);
-				_framePending = false;
-			}
+			WriteFrames();
 		});
 
 		_recording = true;
@@ -71,6 +61,34 @@ bool AviRecorder::StartRecording(uint32_t width, uint32_t height, uint32_t bpp,
 	return true;
 }
 
+void AviRecorder::WriteFrames()
+{
+	while(true) {
+		AviFrame* frame = nullptr;
+		{
+			auto lock = _lock.AcquireSafe();
+			if(!_pendingFrames.empty()) {
+				frame = _pendingFrames.front();
+				_pendingFrames.pop_front();
+			}
+		}
+
+		if(frame) {
+			_aviWriter->AddFrame(frame->FrameData.data(), frame->AudioData.data(), (uint32_t)frame->AudioData.size() / 2);
+			{
+				auto lock = _lock.AcquireSafe();
+				_freeBuffers.push_back(frame);
+			}
+			_waitBuffer.Signal();
+		} else if(_stopFlag) {
+			//All queued frames have been written
+			break;
+		} else {
+			_waitFrame.Wait();
+		}
+	}
+}
+
 void AviRecorder::StopRecording()
 {
 	if(_recording) {
@@ -82,6 +100,10 @@ void AviRecorder::StopRecording()
 
 		_aviWriter->EndWrite();
 		_aviWriter.reset();
+
+		_frameBuffers.clear();
+		_freeBuffers.clear();
+		_pendingAudio.clear();
 	}
 }
 
@@ -91,14 +113,29 @@ bool AviRecorder::AddFrame(void* frameBuffer, uint32_t width, uint32_t height, d
 		if(_width != width || _height != height || _fps != fps) {
 			return false;
 		} else {
-			while(_framePending) {
-				//Previous frame isn't done processing yet, wait
-				std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(1));
+			AviFrame* buffer = nullptr;
+			while(true) {
+				{
+					auto lock = _lock.AcquireSafe();
+					if(!_freeBuffers.empty()) {
+						buffer = _freeBuffers.back();
+						_freeBuffers.pop_back();
+						break;
+					}
+				}
+
+				//All buffers are queued, wait for the encoder to catch up
+				_waitBuffer.Wait();
 			}
 
-			auto lock = _lock.AcquireSafe();
-			_framePending = true;
-			memcpy(_frameBuffer, frameBuffer, _frameBufferLength);
+			memcpy(buffer->FrameData.data(), frameBuffer, _frameBufferLength);
+			{
+				//Queue the audio along with the frame, to keep the audio and video chunks interleaved in the file
+				auto lock = _lock.AcquireSafe();
+				buffer->AudioData.assign(_pendingAudio.begin(), _pendingAudio.end());
+				_pendingAudio.clear();
+				_pendingFrames.push_back(buffer);
+			}
 			_waitFrame.Signal();
 		}
 	}
@@ -111,7 +148,8 @@ bool AviRecorder::AddSound(int16_t* soundBuffer, uint32_t sampleCount, uint32_t
 		if(_sampleRate != sampleRate) {
 			return false;
 		} else {
-			_aviWriter->AddSound(soundBuffer, sampleCount);
+			auto lock = _lock.AcquireSafe();
+			_pendingAudio.insert(_pendingAudio.end(), soundBuffer, soundBuffer + sampleCount * 2);
 		}
 	}
 	return true;
@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include <thread>
+#include <deque>
 #include "Utilities/AutoResetEvent.h"
 #include "Utilities/SimpleLock.h"
 #include "Utilities/Video/AviWriter.h"
@@ -9,6 +10,14 @@
 class AviRecorder final : public IVideoRecorder
 {
 private:
+	static constexpr int MaxPendingFrames = 8;
+
+	struct AviFrame
+	{
+		vector<uint8_t> FrameData;
+		vector<int16_t> AudioData; //Audio samples produced since the previous frame (stereo)
+	};
+
 	std::thread _aviWriterThread;
 	
 	unique_ptr<AviWriter> _aviWriter;
@@ -16,12 +25,15 @@ private:
 	string _outputFile;
 	SimpleLock _lock;
 	AutoResetEvent _waitFrame;
+	AutoResetEvent _waitBuffer;
 
 	atomic<bool> _stopFlag;
-	atomic<bool> _framePending;
 
 	bool _recording;
-	uint8_t* _frameBuffer;
+	vector<unique_ptr<AviFrame>> _frameBuffers;
+	vector<AviFrame*> _freeBuffers;
+	std::deque<AviFrame*> _pendingFrames;
+	vector<int16_t> _pendingAudio;
 	uint32_t _frameBufferLength;
 	uint32_t _sampleRate;
 
@@ -32,6 +44,8 @@ private:
 	VideoCodec _codec;
 	uint32_t _compressionLevel;
 
+	void WriteFrames();
+
 public:
 	AviRecorder(VideoCodec codec, uint32_t compressionLevel);
 	virtual ~AviRecorder();
@@ -100,7 +100,6 @@ bool AviWriter::StartWrite(string filename, VideoCodec codec, uint32_t width, ui
 	}
 	_frames = 0;
 	_written = 0;
-	_audioPos = 0;
 	_audiowritten = 0;
 
 	return true;
@@ -233,7 +232,7 @@ void AviWriter::EndWrite()
 	_file.close();
 }
 
-void AviWriter::AddFrame(uint8_t *frameData)
+void AviWriter::AddFrame(uint8_t *frameData, int16_t *audioData, uint32_t sampleCount)
 {
 	if(!_file) {
 		return;
@@ -253,21 +252,8 @@ void AviWriter::AddFrame(uint8_t *frameData)
 	WriteAviChunk(_codecType == VideoCodec::None ? "00db" : "00dc", written, compressedData, isKeyFrame ? 0x10 : 0);
 	_frames++;
 
-	if(_audioPos) {
-		auto lock = _audioLock.AcquireSafe();
-		WriteAviChunk("01wb", _audioPos, _audiobuf, 0);
-		_audiowritten += _audioPos;
-		_audioPos = 0;
+	if(sampleCount) {
+		WriteAviChunk("01wb", sampleCount * 4, audioData, 0);
+		_audiowritten += sampleCount * 4;
 	}
-}
-
-void AviWriter::AddSound(int16_t *data, uint32_t sampleCount)
-{
-	if(!_file) {
-		return;
-	}
-
-	auto lock = _audioLock.AcquireSafe();
-	memcpy(_audiobuf+_audioPos/2, data, sampleCount * 4);
-	_audioPos += sampleCount * 4;
 }
\ No newline at end of file
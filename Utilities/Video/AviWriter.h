@@ -3,7 +3,6 @@
 
 #pragma once
 #include "pch.h"
-#include "Utilities/SimpleLock.h"
 #include "Utilities/Video/BaseCodec.h"
 
 enum class VideoCodec
@@ -11,13 +10,14 @@ enum class VideoCodec
 	None = 0,
 	ZMBV = 1,
 	CSCD = 2,
-	GIF = 3
+	GIF = 3,
+	RawStream = 4,
+	PngSequence = 5
 };
 
 class AviWriter
 {
 private:
-	static constexpr int WaveBufferSize = 16 * 1024;
 	static constexpr int AviHeaderSize = 500;
 
 	std::unique_ptr<BaseCodec> _codec;
@@ -25,8 +25,6 @@ private:
 
 	VideoCodec _codecType;
 
-	int16_t _audiobuf[WaveBufferSize];
-	uint32_t _audioPos = 0;
 	uint32_t _audiorate = 0;
 	uint32_t _audiowritten = 0;
 
@@ -40,8 +38,6 @@ private:
 	uint8_t* _frameBuffer = nullptr;
 
 	vector<uint8_t> _aviIndex;
-	
-	SimpleLock _audioLock;
 
 private:
 	void host_writew(uint8_t* buffer, uint16_t value);
@@ -49,8 +45,8 @@ private:
 	void WriteAviChunk(const char * tag, uint32_t size, void * data, uint32_t flags);
 
 public:
-	void AddFrame(uint8_t* frameData);
-	void AddSound(int16_t * data, uint32_t sampleCount);
+	//Writes a video frame, followed by the audio samples produced during that frame
+	void AddFrame(uint8_t* frameData, int16_t* audioData, uint32_t sampleCount);
 
 	bool StartWrite(string filename, VideoCodec codec, uint32_t width, uint32_t height, uint32_t bpp, uint32_t fps, uint32_t audioSampleRate, uint32_t compressionLevel);
 	void EndWrite();
@@ -29,15 +29,43 @@ bool GifRecorder::StartRecording(uint32_t width, uint32_t height, uint32_t bpp,
 	_height = height;
 	_fps = fps;
 
-	_recording = GifBegin(_gif.get(), _outputFile.c_str(), width, height, 2, 8, false);
+	_recording = GifBegin(_gif.get(), _outputFile.c_str(), width, height, GifRecorder::FrameDelay, 8, false);
 	_frameCounter = 0;
+
+	if(_recording) {
+		_canvas.resize(width * height * 4);
+		_firstFrame = true;
+		_stopFlag = false;
+
+		//Frames are palettized and compressed on a separate thread, using a pool of buffers
+		for(int i = 0; i < GifRecorder::MaxPendingFrames; i++) {
+			_frameBuffers.push_back(new uint8_t[width * height * 4]);
+		}
+		_freeBuffers = _frameBuffers;
+
+		_writerThread = std::thread([=]() {
+			WriteFrames();
+		});
+	}
 	return _recording;
 }
 
 void GifRecorder::StopRecording()
 {
 	if(_recording) {
+		_recording = false;
+
+		_stopFlag = true;
+		_waitFrame.Signal();
+		_writerThread.join();
+
 		GifEnd(_gif.get());
+
+		for(uint8_t* buffer : _frameBuffers) {
+			delete[] buffer;
+		}
+		_frameBuffers.clear();
+		_freeBuffers.clear();
 	}
 }
 
@@ -48,15 +76,182 @@ bool GifRecorder::AddFrame(void* frameBuffer, uint32_t width, uint32_t height, d
 	}
 
 	_frameCounter++;
-	
+
 	if(fps < 55 || (_frameCounter % 6) != 0) {
 		//At 60 FPS, skip 1 of every 6 frames (max FPS for GIFs is 50fps)
-		GifWriteFrame(_gif.get(), (uint8_t*)frameBuffer, width, height, 2, 8, false);
+		uint8_t* buffer = nullptr;
+		while(true) {
+			{
+				auto lock = _lock.AcquireSafe();
+				if(!_freeBuffers.empty()) {
+					buffer = _freeBuffers.back();
+					_freeBuffers.pop_back();
+					break;
+				}
+			}
+
+			//All buffers are queued, wait for the writer thread to catch up
+			_waitBuffer.Wait();
+		}
+
+		memcpy(buffer, frameBuffer, width * height * 4);
+		{
+			auto lock = _lock.AcquireSafe();
+			_pendingFrames.push_back(buffer);
+		}
+		_waitFrame.Signal();
+	}
+
+	return true;
+}
+
+void GifRecorder::WriteFrames()
+{
+	while(true) {
+		uint8_t* frame = nullptr;
+		{
+			auto lock = _lock.AcquireSafe();
+			if(!_pendingFrames.empty()) {
+				frame = _pendingFrames.front();
+				_pendingFrames.pop_front();
+			}
+		}
+
+		if(frame) {
+			WriteFrame(frame);
+			{
+				auto lock = _lock.AcquireSafe();
+				_freeBuffers.push_back(frame);
+			}
+			_waitBuffer.Signal();
+		} else if(_stopFlag) {
+			//All queued frames have been written
+			break;
+		} else {
+			_waitFrame.Wait();
+		}
+	}
+}
+
+bool GifRecorder::GetChangedRect(uint8_t* frame, uint32_t& left, uint32_t& top, uint32_t& right, uint32_t& bottom)
+{
+	left = _width;
+	top = _height;
+	right = 0;
+	bottom = 0;
+
+	bool changed = false;
+	uint32_t* src = (uint32_t*)frame;
+	uint32_t* canvas = (uint32_t*)_canvas.data();
+	for(uint32_t y = 0; y < _height; y++) {
+		for(uint32_t x = 0; x < _width; x++) {
+			if((src[x] ^ canvas[x]) & 0xFFFFFF) {
+				left = std::min(left, x);
+				right = std::max(right, x);
+				top = std::min(top, y);
+				bottom = y;
+				changed = true;
+			}
+		}
+		src += _width;
+		canvas += _width;
+	}
+	return changed;
+}
+
+bool GifRecorder::BuildExactPalette(uint32_t width, uint32_t height, GifPalette& pal)
+{
+	//Most frames use less than 256 colors, try to build a palette that contains every color in the changed region
+	_colorIndexes.clear();
+
+	uint32_t pixelCount = width * height;
+	uint32_t* src = (uint32_t*)_rectImage.data();
+	uint32_t* canvas = (uint32_t*)_rectCanvas.data();
+	uint32_t* out = (uint32_t*)_rectOutput.data();
+	for(uint32_t i = 0; i < pixelCount; i++) {
+		uint32_t color = src[i] & 0xFFFFFF;
+		if(!_firstFrame && color == (canvas[i] & 0xFFFFFF)) {
+			//Unchanged pixel, use the transparent color
+			out[i] = color | (kGifTransIndex << 24);
+			continue;
+		}
+
+		auto result = _colorIndexes.find(color);
+		uint8_t index;
+		if(result == _colorIndexes.end()) {
+			if(_colorIndexes.size() >= 255) {
+				return false;
+			}
+			index = (uint8_t)(_colorIndexes.size() + 1);
+			_colorIndexes[color] = index;
+		} else {
+			index = result->second;
+		}
+		out[i] = color | (index << 24);
+	}
+
+	memset(&pal, 0, sizeof(pal));
+	for(auto& entry : _colorIndexes) {
+		pal.r[entry.second] = (uint8_t)entry.first;
+		pal.g[entry.second] = (uint8_t)(entry.first >> 8);
+		pal.b[entry.second] = (uint8_t)(entry.first >> 16);
 	}
 
+	pal.bitDepth = 2;
+	while((1u << pal.bitDepth) <= _colorIndexes.size()) {
+		pal.bitDepth++;
+	}
 	return true;
 }
 
+void GifRecorder::BuildQuantizedPalette(uint32_t width, uint32_t height, GifPalette& pal)
+{
+	//Too many colors for an exact palette, use gif.h's median split quantizer on the changed region
+	uint8_t* lastFrame = _firstFrame ? nullptr : _rectCanvas.data();
+	GifMakePalette(lastFrame, _rectImage.data(), width, height, 8, false, &pal);
+	GifThresholdImage(lastFrame, _rectImage.data(), _rectOutput.data(), width, height, &pal);
+}
+
+void GifRecorder::WriteFrame(uint8_t* frame)
+{
+	uint32_t left, top, right, bottom;
+	if(_firstFrame) {
+		left = 0;
+		top = 0;
+		right = _width - 1;
+		bottom = _height - 1;
+	} else if(!GetChangedRect(frame, left, top, right, bottom)) {
+		//Nothing changed, write a single transparent pixel to keep the frame's timing
+		left = top = right = bottom = 0;
+	}
+
+	uint32_t width = right - left + 1;
+	uint32_t height = bottom - top + 1;
+	size_t rectSize = width * height * 4;
+	_rectImage.resize(rectSize);
+	_rectCanvas.resize(rectSize);
+	_rectOutput.resize(rectSize);
+
+	for(uint32_t y = 0; y < height; y++) {
+		size_t srcOffset = ((top + y) * _width + left) * 4;
+		memcpy(_rectImage.data() + y * width * 4, frame + srcOffset, width * 4);
+		memcpy(_rectCanvas.data() + y * width * 4, _canvas.data() + srcOffset, width * 4);
+	}
+
+	GifPalette pal;
+	if(!BuildExactPalette(width, height, pal)) {
+		BuildQuantizedPalette(width, height, pal);
+	}
+
+	//Update the canvas with the colors that will actually be displayed
+	for(uint32_t y = 0; y < height; y++) {
+		memcpy(_canvas.data() + ((top + y) * _width + left) * 4, _rectOutput.data() + y * width * 4, width * 4);
+	}
+	_firstFrame = false;
+
+	GifWriteLzwImage(_gif->f, _rectOutput.data(), left, top, width, height, GifRecorder::FrameDelay, &pal);
+}
+
 bool GifRecorder::AddSound(int16_t* soundBuffer, uint32_t sampleCount, uint32_t sampleRate)
 {
 	return true;
@@ -70,4 +265,4 @@ bool GifRecorder::IsRecording()
 string GifRecorder::GetOutputFile()
 {
 	return _outputFile;
-}
\ No newline at end of file
+}
@@ -1,12 +1,20 @@
 #pragma once
 #include "pch.h"
+#include <thread>
+#include <deque>
+#include "Utilities/AutoResetEvent.h"
+#include "Utilities/SimpleLock.h"
 #include "Utilities/Video/IVideoRecorder.h"
 
 struct GifWriter;
+struct GifPalette;
 
 class GifRecorder final : public IVideoRecorder
 {
 private:
+	static constexpr int MaxPendingFrames = 8;
+	static constexpr uint32_t FrameDelay = 2;
+
 	std::unique_ptr<GifWriter> _gif;
 	bool _recording = false;
 	uint32_t _frameCounter = 0;
@@ -15,6 +23,32 @@ private:
 	uint32_t _height = 0;
 	double _fps = 0;
 
+	std::thread _writerThread;
+	SimpleLock _lock;
+	AutoResetEvent _waitFrame;
+	AutoResetEvent _waitBuffer;
+	atomic<bool> _stopFlag = false;
+
+	vector<uint8_t*> _frameBuffers;
+	vector<uint8_t*> _freeBuffers;
+	std::deque<uint8_t*> _pendingFrames;
+
+	//Current content of the gif's canvas (what is displayed after the last written frame)
+	vector<uint8_t> _canvas;
+	bool _firstFrame = true;
+
+	//Work buffers for the changed region of the frame
+	vector<uint8_t> _rectImage;
+	vector<uint8_t> _rectCanvas;
+	vector<uint8_t> _rectOutput;
+	unordered_map<uint32_t, uint8_t> _colorIndexes;
+
+	void WriteFrames();
+	void WriteFrame(uint8_t* frame);
+	bool GetChangedRect(uint8_t* frame, uint32_t& left, uint32_t& top, uint32_t& right, uint32_t& bottom);
+	bool BuildExactPalette(uint32_t width, uint32_t height, GifPalette& pal);
+	void BuildQuantizedPalette(uint32_t width, uint32_t height, GifPalette& pal);
+
 public:
 	GifRecorder();
 	virtual ~GifRecorder();
@@ -26,4 +60,4 @@ public:
 	bool AddSound(int16_t* soundBuffer, uint32_t sampleCount, uint32_t sampleRate) override;
 	bool IsRecording() override;
 	string GetOutputFile() override;
-};
\ No newline at end of file
+};
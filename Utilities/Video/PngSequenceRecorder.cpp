@@ -0,0 +1,199 @@
+#include "pch.h"
+#include "PngSequenceRecorder.h"
+#include "Utilities/FolderUtilities.h"
+#include "Utilities/PNGHelper.h"
+
+PngSequenceRecorder::~PngSequenceRecorder()
+{
+	StopRecording();
+}
+
+bool PngSequenceRecorder::Init(string filename)
+{
+	_outputFile = filename;
+
+	string ext = FolderUtilities::GetExtension(filename);
+	_basePath = ext == ".png" ? filename.substr(0, filename.size() - ext.size()) : filename;
+
+	_wavFile.open(_basePath + ".wav", std::ios::out | std::ios::binary);
+	return _wavFile.good();
+}
+
+bool PngSequenceRecorder::StartRecording(uint32_t width, uint32_t height, uint32_t bpp, uint32_t audioSampleRate, double fps)
+{
+	if(!_recording) {
+		if(bpp != 4) {
+			return false;
+		}
+
+		_width = width;
+		_height = height;
+		_fps = fps;
+		_sampleRate = audioSampleRate;
+		_frameNumber = 0;
+		_audioDataSize = 0;
+
+		WriteWavHeader();
+
+		uint32_t threadCount = std::max(1u, std::min(std::thread::hardware_concurrency(), PngSequenceRecorder::MaxEncoderThreads));
+
+		//Allow each thread to have a frame queued while encoding another one
+		for(uint32_t i = 0; i < threadCount * 2; i++) {
+			_frameBuffers.push_back(new uint8_t[width * height * 4]);
+		}
+		_freeBuffers = _frameBuffers;
+
+		_stopFlag = false;
+		for(uint32_t i = 0; i < threadCount; i++) {
+			_waitFrame.push_back(std::make_unique<AutoResetEvent>());
+		}
+		for(uint32_t i = 0; i < threadCount; i++) {
+			_encoderThreads.push_back(std::thread([=]() {
+				EncodeFrames(i);
+			}));
+		}
+
+		_recording = true;
+	}
+	return true;
+}
+
+void PngSequenceRecorder::WriteWavHeader()
+{
+	uint32_t blockAlign = 2 * sizeof(int16_t);
+	uint32_t header[11] = {
+		0x46464952, //"RIFF"
+		36 + _audioDataSize,
+		0x45564157, //"WAVE"
+		0x20746D66, //"fmt "
+		16,
+		1 | (2 << 16), //PCM, 2 channels
+		_sampleRate,
+		_sampleRate * blockAlign,
+		blockAlign | (16 << 16), //block align, 16 bits per sample
+		0x61746164, //"data"
+		_audioDataSize
+	};
+
+	_wavFile.seekp(0, std::ios::beg);
+	_wavFile.write((char*)header, sizeof(header));
+}
+
+void PngSequenceRecorder::EncodeFrames(uint32_t threadIndex)
+{
+	char filename[32];
+	while(true) {
+		PendingFrame frame = {};
+		{
+			auto lock = _lock.AcquireSafe();
+			if(!_pendingFrames.empty()) {
+				frame = _pendingFrames.front();
+				_pendingFrames.pop_front();
+			}
+		}
+
+		if(frame.Buffer) {
+			snprintf(filename, sizeof(filename), "_%06u.png", frame.FrameNumber);
+			PNGHelper::WritePNG(_basePath + filename, (uint32_t*)frame.Buffer, _width, _height);
+			{
+				auto lock = _lock.AcquireSafe();
+				_freeBuffers.push_back(frame.Buffer);
+			}
+			_waitBuffer.Signal();
+		} else if(_stopFlag) {
+			//All queued frames have been written
+			break;
+		} else {
+			_waitFrame[threadIndex]->Wait();
+		}
+	}
+}
+
+void PngSequenceRecorder::StopRecording()
+{
+	if(_recording) {
+		_recording = false;
+
+		_stopFlag = true;
+		for(unique_ptr<AutoResetEvent>& evt : _waitFrame) {
+			evt->Signal();
+		}
+		for(std::thread& thread : _encoderThreads) {
+			thread.join();
+		}
+		_encoderThreads.clear();
+		_waitFrame.clear();
+
+		//Update the chunk sizes in the wav file's header
+		auto lock = _audioLock.AcquireSafe();
+		WriteWavHeader();
+		_wavFile.close();
+
+		for(uint8_t* buffer : _frameBuffers) {
+			delete[] buffer;
+		}
+		_frameBuffers.clear();
+		_freeBuffers.clear();
+	}
+}
+
+bool PngSequenceRecorder::AddFrame(void* frameBuffer, uint32_t width, uint32_t height, double fps)
+{
+	if(_recording) {
+		if(_width != width || _height != height || _fps != fps) {
+			return false;
+		}
+
+		uint8_t* buffer = nullptr;
+		while(true) {
+			{
+				auto lock = _lock.AcquireSafe();
+				if(!_freeBuffers.empty()) {
+					buffer = _freeBuffers.back();
+					_freeBuffers.pop_back();
+					break;
+				}
+			}
+
+			//All buffers are queued, wait for the encoder threads to catch up
+			_waitBuffer.Wait();
+		}
+
+		memcpy(buffer, frameBuffer, width * height * 4);
+		{
+			auto lock = _lock.AcquireSafe();
+			_pendingFrames.push_back({ _frameNumber, buffer });
+		}
+		_frameNumber++;
+
+		for(unique_ptr<AutoResetEvent>& evt : _waitFrame) {
+			evt->Signal();
+		}
+	}
+	return true;
+}
+
+bool PngSequenceRecorder::AddSound(int16_t* soundBuffer, uint32_t sampleCount, uint32_t sampleRate)
+{
+	if(_recording) {
+		if(_sampleRate != sampleRate) {
+			return false;
+		}
+
+		auto lock = _audioLock.AcquireSafe();
+		uint32_t size = sampleCount * 2 * sizeof(int16_t);
+		_wavFile.write((char*)soundBuffer, size);
+		_audioDataSize += size;
+	}
+	return true;
+}
+
+bool PngSequenceRecorder::IsRecording()
+{
+	return _recording;
+}
+
+string PngSequenceRecorder::GetOutputFile()
+{
+	return _outputFile;
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "pch.h"
+#include <thread>
+#include <deque>
+#include "Utilities/AutoResetEvent.h"
+#include "Utilities/SimpleLock.h"
+#include "Utilities/Video/IVideoRecorder.h"
+
+//Saves each frame as a separate lossless PNG file (e.g "name_000000.png", "name_000001.png", etc.) and the audio as a .wav file.
+//Frames are compressed in parallel on several threads.
+class PngSequenceRecorder final : public IVideoRecorder
+{
+private:
+	static constexpr uint32_t MaxEncoderThreads = 8;
+
+	struct PendingFrame
+	{
+		uint32_t FrameNumber;
+		uint8_t* Buffer;
+	};
+
+	vector<std::thread> _encoderThreads;
+	SimpleLock _lock;
+	AutoResetEvent _waitBuffer;
+	atomic<bool> _stopFlag = false;
+
+	//One event per encoder thread, to wake up the threads when frames are queued
+	vector<unique_ptr<AutoResetEvent>> _waitFrame;
+
+	bool _recording = false;
+	vector<uint8_t*> _frameBuffers;
+	vector<uint8_t*> _freeBuffers;
+	std::deque<PendingFrame> _pendingFrames;
+	uint32_t _frameNumber = 0;
+
+	string _outputFile;
+	string _basePath;
+	SimpleLock _audioLock;
+	ofstream _wavFile;
+	uint32_t _audioDataSize = 0;
+
+	double _fps = 0;
+	uint32_t _width = 0;
+	uint32_t _height = 0;
+	uint32_t _sampleRate = 0;
+
+	void EncodeFrames(uint32_t threadIndex);
+	void WriteWavHeader();
+
+public:
+	virtual ~PngSequenceRecorder();
+
+	bool Init(string filename) override;
+	bool StartRecording(uint32_t width, uint32_t height, uint32_t bpp, uint32_t audioSampleRate, double fps) override;
+	void StopRecording() override;
+
+	bool AddFrame(void* frameBuffer, uint32_t width, uint32_t height, double fps) override;
+	bool AddSound(int16_t* soundBuffer, uint32_t sampleCount, uint32_t sampleRate) override;
+
+	bool IsRecording() override;
+	string GetOutputFile() override;
+};
@@ -0,0 +1,204 @@
+#include "pch.h"
+#include "RawStreamRecorder.h"
+
+static constexpr uint32_t MakeFourCC(char a, char b, char c, char d)
+{
+	return (uint8_t)a | ((uint8_t)b << 8) | ((uint8_t)c << 16) | ((uint32_t)(uint8_t)d << 24);
+}
+
+static constexpr uint32_t HeaderTag = MakeFourCC('M', 'R', 'A', 'W');
+static constexpr uint32_t VideoPacketTag = MakeFourCC('V', 'I', 'D', 'F');
+static constexpr uint32_t AudioPacketTag = MakeFourCC('A', 'U', 'D', 'F');
+
+RawStreamRecorder::~RawStreamRecorder()
+{
+	StopRecording();
+}
+
+bool RawStreamRecorder::Init(string filename)
+{
+	_outputFile = filename;
+
+	//Keep the stream open until recording ends - reopening a pipe would cause the reader to see the end of the stream
+	_stream.open(filename, std::ios::out | std::ios::binary);
+	return _stream.good();
+}
+
+bool RawStreamRecorder::StartRecording(uint32_t width, uint32_t height, uint32_t bpp, uint32_t audioSampleRate, double fps)
+{
+	if(!_recording) {
+		if(bpp != 4 || !_stream) {
+			return false;
+		}
+
+		_width = width;
+		_height = height;
+		_fps = fps;
+		_sampleRate = audioSampleRate;
+
+		for(int i = 0; i < RawStreamRecorder::MaxPendingFrames; i++) {
+			_packets.push_back(std::make_unique<Packet>());
+			_packets.back()->Type = VideoPacketTag;
+			_packets.back()->Data.resize(width * height * 4);
+			_freeFrames.push_back(_packets.back().get());
+		}
+
+		WriteHeader();
+
+		_stopFlag = false;
+		_writerThread = std::thread([=]() {
+			WritePackets();
+		});
+
+		_recording = true;
+	}
+	return true;
+}
+
+void RawStreamRecorder::WriteHeader()
+{
+	uint32_t header[8] = {
+		HeaderTag,
+		RawStreamRecorder::FormatVersion,
+		_width,
+		_height,
+		(uint32_t)(_fps * RawStreamRecorder::FpsDenominator),
+		RawStreamRecorder::FpsDenominator,
+		_sampleRate,
+		2
+	};
+	_stream.write((char*)header, sizeof(header));
+}
+
+void RawStreamRecorder::WritePackets()
+{
+	while(true) {
+		Packet* packet = nullptr;
+		{
+			auto lock = _lock.AcquireSafe();
+			if(!_pendingPackets.empty()) {
+				packet = _pendingPackets.front();
+				_pendingPackets.pop_front();
+			}
+		}
+
+		if(packet) {
+			if(!_writeError) {
+				uint32_t packetHeader[2] = { packet->Type, (uint32_t)packet->Data.size() };
+				_stream.write((char*)packetHeader, sizeof(packetHeader));
+				_stream.write((char*)packet->Data.data(), packet->Data.size());
+				if(!_stream) {
+					//The reader closed the pipe or the disk is full, stop recording on the next frame
+					_writeError = true;
+				}
+			}
+
+			{
+				auto lock = _lock.AcquireSafe();
+				if(packet->Type == VideoPacketTag) {
+					_freeFrames.push_back(packet);
+				} else {
+					_freeAudio.push_back(packet);
+				}
+			}
+			_waitBuffer.Signal();
+		} else if(_stopFlag) {
+			//All queued packets have been written
+			break;
+		} else {
+			_waitPacket.Wait();
+		}
+	}
+}
+
+void RawStreamRecorder::QueuePacket(Packet* packet)
+{
+	{
+		auto lock = _lock.AcquireSafe();
+		_pendingPackets.push_back(packet);
+	}
+	_waitPacket.Signal();
+}
+
+void RawStreamRecorder::StopRecording()
+{
+	if(_recording) {
+		_recording = false;
+
+		_stopFlag = true;
+		_waitPacket.Signal();
+		_writerThread.join();
+
+		_stream.close();
+
+		_freeFrames.clear();
+		_freeAudio.clear();
+		_packets.clear();
+	}
+}
+
+bool RawStreamRecorder::AddFrame(void* frameBuffer, uint32_t width, uint32_t height, double fps)
+{
+	if(_recording) {
+		if(_width != width || _height != height || _fps != fps || _writeError) {
+			return false;
+		}
+
+		Packet* packet = nullptr;
+		while(true) {
+			{
+				auto lock = _lock.AcquireSafe();
+				if(!_freeFrames.empty()) {
+					packet = _freeFrames.back();
+					_freeFrames.pop_back();
+					break;
+				}
+			}
+
+			//All buffers are queued, wait for the reader to catch up
+			_waitBuffer.Wait();
+		}
+
+		memcpy(packet->Data.data(), frameBuffer, packet->Data.size());
+		QueuePacket(packet);
+	}
+	return true;
+}
+
+bool RawStreamRecorder::AddSound(int16_t* soundBuffer, uint32_t sampleCount, uint32_t sampleRate)
+{
+	if(_recording) {
+		if(_sampleRate != sampleRate || _writeError) {
+			return false;
+		}
+
+		Packet* packet = nullptr;
+		{
+			auto lock = _lock.AcquireSafe();
+			if(!_freeAudio.empty()) {
+				packet = _freeAudio.back();
+				_freeAudio.pop_back();
+			} else {
+				//Audio packets are small, allocate a new one rather than blocking the emulation thread
+				_packets.push_back(std::make_unique<Packet>());
+				packet = _packets.back().get();
+				packet->Type = AudioPacketTag;
+			}
+		}
+
+		packet->Data.resize(sampleCount * 2 * sizeof(int16_t));
+		memcpy(packet->Data.data(), soundBuffer, packet->Data.size());
+		QueuePacket(packet);
+	}
+	return true;
+}
+
+bool RawStreamRecorder::IsRecording()
+{
+	return _recording;
+}
+
+string RawStreamRecorder::GetOutputFile()
+{
+	return _outputFile;
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include "pch.h"
+#include <thread>
+#include <deque>
+#include "Utilities/AutoResetEvent.h"
+#include "Utilities/SimpleLock.h"
+#include "Utilities/Video/IVideoRecorder.h"
+
+//Writes uncompressed video frames and audio samples to a file or pipe, to be processed by an external encoder.
+//The output can be a regular file, a named pipe (e.g created with mkfifo, or \\.\pipe\name on Windows) or /dev/fd/N.
+//When writing to a pipe, Init() blocks until the reader opens its end of the pipe.
+//
+//Stream format (all values are little endian):
+//  Header (32 bytes):
+//    char[4] "MRAW", uint32 version (1), uint32 width, uint32 height,
+//    uint32 fps numerator, uint32 fps denominator, uint32 audio sample rate, uint32 audio channel count (2)
+//  Followed by any number of packets:
+//    char[4] type, uint32 payload size, payload
+//    "VIDF": one video frame, width*height pixels, 4 bytes per pixel in B, G, R, A order (ffmpeg's "bgra" pixel format)
+//    "AUDF": audio samples, signed 16-bit, interleaved stereo (ffmpeg's "s16le" format)
+class RawStreamRecorder final : public IVideoRecorder
+{
+private:
+	static constexpr int MaxPendingFrames = 8;
+	static constexpr uint32_t FormatVersion = 1;
+	static constexpr uint32_t FpsDenominator = 1000000;
+
+	struct Packet
+	{
+		uint32_t Type;
+		vector<uint8_t> Data;
+	};
+
+	std::thread _writerThread;
+	ofstream _stream;
+	string _outputFile;
+
+	SimpleLock _lock;
+	AutoResetEvent _waitPacket;
+	AutoResetEvent _waitBuffer;
+	atomic<bool> _stopFlag = false;
+	atomic<bool> _writeError = false;
+
+	bool _recording = false;
+	vector<unique_ptr<Packet>> _packets;
+	vector<Packet*> _freeFrames;
+	vector<Packet*> _freeAudio;
+	std::deque<Packet*> _pendingPackets;
+
+	double _fps = 0;
+	uint32_t _width = 0;
+	uint32_t _height = 0;
+	uint32_t _sampleRate = 0;
+
+	void WriteHeader();
+	void WritePackets();
+	void QueuePacket(Packet* packet);
+
+public:
+	virtual ~RawStreamRecorder();
+
+	bool Init(string filename) override;
+	bool StartRecording(uint32_t width, uint32_t height, uint32_t bpp, uint32_t audioSampleRate, double fps) override;
+	void StopRecording() override;
+
+	bool AddFrame(void* frameBuffer, uint32_t width, uint32_t height, double fps) override;
+	bool AddSound(int16_t* soundBuffer, uint32_t sampleCount, uint32_t sampleRate) override;
+
+	bool IsRecording() override;
+	string GetOutputFile() override;
+};
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include <algorithm>
 #include <iterator>
+#include <thread>
 #include "VirtualFile.h"
 #include "Utilities/sha1.h"
 #include "Utilities/ArchiveReader.h"
@@ -10,6 +11,7 @@
 #include "Utilities/Patches/IpsPatcher.h"
 #include "Utilities/Patches/UpsPatcher.h"
 #include "Utilities/CRC32.h"
+#include "Utilities/MemoryMappedFile.h"
 
 const std::initializer_list<string> VirtualFile::RomExtensions = {
 	".nes", ".fds", ".unif", ".unf", ".nsf", ".nsfe", ".studybox",
@@ -161,14 +163,36 @@ string VirtualFile::GetFileExtension()
 
 string VirtualFile::GetSha1Hash()
 {
-	LoadFile();
-	return SHA1::GetHash(_data);
+	if(_sha1Hash.empty()) {
+		LoadFile();
+		_sha1Hash = SHA1::GetHash(_data);
+	}
+	return _sha1Hash;
 }
 
 uint32_t VirtualFile::GetCrc32()
+{
+	if(!_crc32.has_value()) {
+		LoadFile();
+		_crc32 = CRC32::GetCRC(_data);
+	}
+	return _crc32.value();
+}
+
+void VirtualFile::CalculateHashes()
 {
 	LoadFile();
-	return CRC32::GetCRC(_data);
+	if(!_crc32.has_value() && _sha1Hash.empty()) {
+		//Calculate both hashes in parallel
+		uint32_t crc32 = 0;
+		std::thread crcThread([this, &crc32]() { crc32 = CRC32::GetCRC(_data); });
+		_sha1Hash = SHA1::GetHash(_data);
+		crcThread.join();
+		_crc32 = crc32;
+	} else {
+		GetCrc32();
+		GetSha1Hash();
+	}
 }
 
 size_t VirtualFile::GetSize()
@@ -230,6 +254,14 @@ void VirtualFile::InitChunks()
 {
 	if(!_useChunks) {
 		_useChunks = true;
+		if(_data.empty() && !IsArchive()) {
+			shared_ptr<MemoryMappedFile> mappedFile(new MemoryMappedFile());
+			if(mappedFile->Open(_path)) {
+				_mappedFile = mappedFile;
+				_fileSize = (int64_t)_mappedFile->GetSize();
+				return;
+			}
+		}
 		_chunks.resize(GetSize() / VirtualFile::ChunkSize + 1);
 	}
 }
@@ -268,11 +300,18 @@ bool VirtualFile::ReadFile(uint8_t* out, uint32_t expectedSize)
 uint8_t VirtualFile::ReadByte(uint32_t offset)
 {
 	InitChunks();
-	if(offset < 0 || offset > GetSize()) {
+	if(offset >= GetSize()) {
 		//Out of bounds
 		return 0;
 	}
 
+	if(_mappedFile) {
+		return _mappedFile->GetData()[offset];
+	} else if(_data.size() > 0) {
+		//Archives (and files already loaded in memory) can't be read from _path in chunks
+		return _data[offset];
+	}
+
 	uint32_t chunkId = offset / VirtualFile::ChunkSize;
 	uint32_t chunkStart = chunkId * VirtualFile::ChunkSize;
 	if(_chunks[chunkId].size() == 0) {
@@ -285,6 +324,31 @@ uint8_t VirtualFile::ReadByte(uint32_t offset)
 	return _chunks[chunkId][offset - chunkStart];
 }
 
+const uint8_t* VirtualFile::GetSpan(uint32_t offset, uint32_t length)
+{
+	InitChunks();
+	if((uint64_t)offset + length > GetSize()) {
+		//Out of bounds
+		return nullptr;
+	}
+
+	if(_mappedFile) {
+		return _mappedFile->GetData() + offset;
+	} else if(_data.size() > 0) {
+		return _data.data() + offset;
+	}
+
+	uint32_t chunkStart = offset / VirtualFile::ChunkSize * VirtualFile::ChunkSize;
+	if(length == 0 || offset - chunkStart + length > VirtualFile::ChunkSize) {
+		//Range spans more than one chunk, caller needs to use ReadByte
+		return nullptr;
+	}
+
+	//Load the chunk if needed
+	ReadByte(offset);
+	return _chunks[offset / VirtualFile::ChunkSize].data() + (offset - chunkStart);
+}
+
 bool VirtualFile::ApplyPatch(VirtualFile& patch)
 {
 	//Apply patch file
@@ -306,6 +370,8 @@ bool VirtualFile::ApplyPatch(VirtualFile& patch)
 			}
 			if(result) {
 				_data = patchedData;
+				_crc32.reset();
+				_sha1Hash.clear();
 			}
 		}
 	}
@@ -2,6 +2,8 @@
 #include "pch.h"
 #include <sstream>
 
+class MemoryMappedFile;
+
 class VirtualFile
 {
 private:
@@ -13,12 +15,16 @@ private:
 	vector<uint8_t> _data;
 	int64_t _fileSize = -1;
 
+	optional<uint32_t> _crc32;
+	string _sha1Hash;
+
 	vector<vector<uint8_t>> _chunks;
 	bool _useChunks = false;
 
-	void FromStream(std::istream &input, vector<uint8_t> &output);
+	//Uncompressed files are memory mapped when possible, chunks are only used as a fallback
+	shared_ptr<MemoryMappedFile> _mappedFile;
 
-	void LoadFile();
+	void FromStream(std::istream &input, vector<uint8_t> &output);
 
 public:
 	static const std::initializer_list<string> RomExtensions;
@@ -39,6 +45,10 @@ public:
 	string GetFileExtension();
 	string GetSha1Hash();
 	uint32_t GetCrc32();
+	void CalculateHashes();
+
+	//Reads the whole file (or extracts it from its archive) into memory
+	void LoadFile();
 
 	size_t GetSize();
 	bool CheckFileSignature(vector<string> signatures, bool loadArchives = false);
@@ -50,6 +60,10 @@ public:
 
 	uint8_t ReadByte(uint32_t offset);
 
+	//Returns a pointer to "length" contiguous bytes starting at "offset" (or nullptr if the range is out of bounds
+	//or spans more than one chunk). The pointer remains valid for as long as this VirtualFile exists.
+	const uint8_t* GetSpan(uint32_t offset, uint32_t length);
+
 	bool ApplyPatch(VirtualFile &patch);
 
 	template<typename T>
@@ -61,8 +75,13 @@ public:
 			return false;
 		}
 
-		for(int i = start, end = start + length; i < end; i++) {
-			container.push_back(ReadByte(i));
+		const uint8_t* span = GetSpan(start, length);
+		if(span) {
+			container.insert(container.end(), span, span + length);
+		} else {
+			for(int i = start, end = start + length; i < end; i++) {
+				container.push_back(ReadByte(i));
+			}
 		}
 
 		return true;